@@ -19,5 +19,6 @@ rb_tree_t *rb_tree_node(rb_tree_t *parent, int value, rb_color_t color)
 	new_node->color = color;
 	new_node->left = NULL;
 	new_node->right = NULL;
+	new_node->size = 1;
 	return (new_node);
 }
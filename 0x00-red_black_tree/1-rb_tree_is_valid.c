@@ -2,115 +2,89 @@
 
 /**
  * rb_tree_is_valid - checks if a binary tree is a valid Red-Black Tree
+ *
+ * The tree is walked once, in order, by following the parent pointers, so
+ * validation takes O(n) time and O(1) space whatever the shape of the tree.
+ * The values must be strictly increasing and each child must point back to
+ * its parent.
+ *
  * @tree: pointer to root node of the tree to check
  * Return: 1 if tree is valid, otherwise 0
  */
 int rb_tree_is_valid(const rb_tree_t *tree)
 {
-	int height;
-
-	if (!tree)
-		return (0);
-
-	if (tree->color != BLACK)
-		return (0);
-
-	if (!is_bst(tree, 0, 0))
-		return (0);
-
-	if (!correct_colors(tree))
-		return (0);
-
-	height = find_height(tree);
+	const rb_tree_t *node = tree, *from = NULL, *last = NULL;
+	int depth = 0, black = -1;
 
-	if (!check_rb_height(tree, height, 0))
+	if (!tree || tree->color != BLACK)
 		return (0);
-
-	return (1);
-}
-
-/**
- * is_bst - checks if tree is a valid Binary Search Tree
- * @tree: binary tree
- * @min: min in the left subtree
- * @max: max in the right subtree
- * Return: 1 or 0
- */
-int is_bst(const rb_tree_t *tree, int min, int max)
-{
-	if (!tree)
-		return (1);
-
-	if ((min && tree->n < min) || (max && tree->n > max))
-		return (0);
-
-	return (is_bst(tree->left, 0, tree->n) &&
-		 is_bst(tree->right, tree->n, 0));
-}
-
-/**
- * correct_colors - checks if RBT has valid colors
- *
- * @tree: binary tree
- * Return: 1 if yes, 0 if no
- */
-int correct_colors(const rb_tree_t *tree)
-{
-	if (!tree)
-		return (1);
-
-	if (tree->color != RED && tree->color != BLACK)
-		return (0);
-	if (tree->color == RED)
+	while (node)
 	{
-		if (tree->left && (tree->left)->color == RED)
-			return (0);
-		if (tree->right && (tree->right)->color == RED)
-			return (0);
+		if (from == (node == tree ? NULL : node->parent))
+		{
+			if (!rb_valid_enter(node, &depth))
+				return (0);
+			if (node->left)
+			{
+				from = node;
+				node = node->left;
+				continue;
+			}
+			if (!rb_valid_leaf(depth, &black))
+				return (0);
+		}
+		if (from != node->right || from == NULL)
+		{
+			if (last && last->n >= node->n)
+				return (0);
+			last = node;
+			if (node->right)
+			{
+				from = node;
+				node = node->right;
+				continue;
+			}
+			if (!rb_valid_leaf(depth, &black))
+				return (0);
+		}
+		depth -= node->color == BLACK;
+		from = node;
+		node = node == tree ? NULL : node->parent;
 	}
-	return (correct_colors(tree->left) && correct_colors(tree->right));
+	return (1);
 }
 
 /**
- * find_height - gets height of rb tree
+ * rb_valid_enter - checks a node when the walk first reaches it
  *
- * @tree: binary tree
- * Return: maximum of black nodes between root and leaf
+ * @node: node to check
+ * @depth: number of black nodes above @node, @node is added to it
+ * Return: 1 if the node and its links are valid, otherwise 0
  */
-int find_height(const rb_tree_t *tree)
+int rb_valid_enter(const rb_tree_t *node, int *depth)
 {
-	int height;
-
-	if (!tree)
+	if (node->color != RED && node->color != BLACK)
 		return (0);
-
-	height = MAXIMUM(find_height(tree->left), find_height(tree->right));
-
-	if (tree->color == BLACK)
-		height++;
-	return (height);
+	if ((node->left && node->left->parent != node) ||
+	    (node->right && node->right->parent != node))
+		return (0);
+	if (node->color == RED && (!IS_BLACK(node->left) ||
+				   !IS_BLACK(node->right)))
+		return (0);
+	*depth += node->color == BLACK;
+	return (1);
 }
 
 /**
- * check_rb_height - finds the height of black nodes in RBT
+ * rb_valid_leaf - checks the black height at a missing child
  *
- * @tree: tree to check
- * @blk_height: number of black nodes
- * @height: max height
- *
- * Return: 1 if yes, 0 if no
+ * @depth: number of black nodes between the root and the missing child
+ * @black: black height, -1 until the first missing child sets it
+ * Return: 1 if @depth matches the black height, otherwise 0
  */
-int check_rb_height(const rb_tree_t *tree, int blk_height, int height)
+int rb_valid_leaf(int depth, int *black)
 {
-	if (!tree)
-	{
-		if (height == blk_height)
-			return (1);
-		return (0);
-	}
-	if (tree->color == BLACK)
-		height++;
-
-	return (check_rb_height(tree->left, blk_height, height) &&
-		check_rb_height(tree->right, blk_height, height));
+	if (*black == -1)
+		*black = depth;
+	return (*black == depth);
 }
@@ -0,0 +1,69 @@
+#include "rb_trees.h"
+
+/**
+ * rb_tree_first - finds the smallest node of a Red-Black Tree
+ *
+ * @tree: pointer to root node of the tree
+ *
+ * Return: pointer to the smallest node, or NULL if @tree is empty
+ */
+const rb_tree_t *rb_tree_first(const rb_tree_t *tree)
+{
+	if (tree == NULL)
+		return (NULL);
+	while (tree->left)
+		tree = tree->left;
+	return (tree);
+}
+
+/**
+ * rb_tree_last - finds the largest node of a Red-Black Tree
+ *
+ * @tree: pointer to root node of the tree
+ *
+ * Return: pointer to the largest node, or NULL if @tree is empty
+ */
+const rb_tree_t *rb_tree_last(const rb_tree_t *tree)
+{
+	if (tree == NULL)
+		return (NULL);
+	while (tree->right)
+		tree = tree->right;
+	return (tree);
+}
+
+/**
+ * rb_tree_next - finds the in-order successor of a node using parent links
+ *
+ * @node: pointer to the current node
+ *
+ * Return: pointer to the next node, or NULL if @node is the largest
+ */
+const rb_tree_t *rb_tree_next(const rb_tree_t *node)
+{
+	if (node == NULL)
+		return (NULL);
+	if (node->right)
+		return (rb_tree_first(node->right));
+	while (node->parent && node == node->parent->right)
+		node = node->parent;
+	return (node->parent);
+}
+
+/**
+ * rb_tree_prev - finds the in-order predecessor of a node using parent links
+ *
+ * @node: pointer to the current node
+ *
+ * Return: pointer to the previous node, or NULL if @node is the smallest
+ */
+const rb_tree_t *rb_tree_prev(const rb_tree_t *node)
+{
+	if (node == NULL)
+		return (NULL);
+	if (node->left)
+		return (rb_tree_last(node->left));
+	while (node->parent && node == node->parent->left)
+		node = node->parent;
+	return (node->parent);
+}
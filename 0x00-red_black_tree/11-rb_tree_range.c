@@ -0,0 +1,104 @@
+#include "rb_trees.h"
+
+/**
+ * rb_tree_find - looks a value up in a Red-Black Tree
+ *
+ * @tree: pointer to root node of the tree
+ * @n: value to search for
+ *
+ * Return: pointer to the node holding @n, or NULL if it is not in the tree
+ */
+const rb_tree_t *rb_tree_find(const rb_tree_t *tree, int n)
+{
+	while (tree && tree->n != n)
+	{
+		if (n < tree->n)
+			tree = tree->left;
+		else
+			tree = tree->right;
+	}
+	return (tree);
+}
+
+/**
+ * rb_tree_lower_bound - finds the first node not smaller than a value
+ *
+ * @tree: pointer to root node of the tree
+ * @n: value to search for
+ *
+ * Return: pointer to the smallest node >= @n, or NULL if there is none
+ */
+const rb_tree_t *rb_tree_lower_bound(const rb_tree_t *tree, int n)
+{
+	const rb_tree_t *bound = NULL;
+
+	while (tree)
+	{
+		if (tree->n >= n)
+		{
+			bound = tree;
+			tree = tree->left;
+		}
+		else
+			tree = tree->right;
+	}
+	return (bound);
+}
+
+/**
+ * rb_tree_upper_bound - finds the first node greater than a value
+ *
+ * @tree: pointer to root node of the tree
+ * @n: value to search for
+ *
+ * Return: pointer to the smallest node > @n, or NULL if there is none
+ */
+const rb_tree_t *rb_tree_upper_bound(const rb_tree_t *tree, int n)
+{
+	const rb_tree_t *bound = NULL;
+
+	while (tree)
+	{
+		if (tree->n > n)
+		{
+			bound = tree;
+			tree = tree->left;
+		}
+		else
+			tree = tree->right;
+	}
+	return (bound);
+}
+
+/**
+ * rb_tree_range - calls a function on every node whose value is in [lo, hi]
+ *
+ * Nodes are visited in ascending order by following parent links from the
+ * lower bound, so the scan costs O(log(n) + k) and allocates nothing.
+ *
+ * @tree: pointer to root node of the tree
+ * @lo: smallest value to visit
+ * @hi: largest value to visit
+ * @action: function called for each node in range
+ * @data: passed as is to @action
+ *
+ * Return: number of nodes visited
+ */
+size_t rb_tree_range(const rb_tree_t *tree, int lo, int hi,
+		     void (*action)(const rb_tree_t *node, void *data),
+		     void *data)
+{
+	const rb_tree_t *node;
+	size_t count = 0;
+
+	if (action == NULL)
+		return (0);
+
+	for (node = rb_tree_lower_bound(tree, lo); node && node->n <= hi;
+	     node = rb_tree_next(node))
+	{
+		action(node, data);
+		count++;
+	}
+	return (count);
+}
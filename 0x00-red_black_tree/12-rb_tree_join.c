@@ -0,0 +1,163 @@
+#include "rb_trees.h"
+
+/**
+ * rb_black_height - counts the black nodes from a root down to a leaf
+ *
+ * @tree: pointer to root node of the tree
+ *
+ * Return: black height of @tree, 0 if it is empty
+ */
+int rb_black_height(const rb_tree_t *tree)
+{
+	int height = 0;
+
+	for (; tree != NULL; tree = tree->left)
+		if (tree->color == BLACK)
+			height++;
+	return (height);
+}
+
+/**
+ * rb_join_right - joins a shorter tree to the right spine of a taller one
+ *
+ * @tree: taller tree, holding the smaller values
+ * @key: node to link between both trees
+ * @right: shorter tree, holding the larger values
+ * @height: black height of @tree
+ * @target: black height of @right
+ *
+ * Return: pointer to root node of the joined tree
+ */
+rb_tree_t *rb_join_right(rb_tree_t *tree, rb_tree_t *key, rb_tree_t *right,
+			 int height, int target)
+{
+	rb_tree_t *c = tree, *p = NULL;
+
+	while (c && (height > target || c->color == RED))
+	{
+		if (c->color == BLACK)
+			height--;
+		p = c;
+		c = c->right;
+	}
+	key->left = c;
+	key->right = right;
+	key->parent = p;
+	key->color = RED;
+	key->size = RB_SIZE(c) + RB_SIZE(right) + 1;
+	if (c)
+		c->parent = key;
+	if (right)
+		right->parent = key;
+	p->right = key;
+	rb_tree_resize(p, RB_SIZE(right) + 1);
+	rb_insert_fixup(&tree, key);
+	return (tree);
+}
+
+/**
+ * rb_join_left - joins a shorter tree to the left spine of a taller one
+ *
+ * @left: shorter tree, holding the smaller values
+ * @key: node to link between both trees
+ * @tree: taller tree, holding the larger values
+ * @height: black height of @tree
+ * @target: black height of @left
+ *
+ * Return: pointer to root node of the joined tree
+ */
+rb_tree_t *rb_join_left(rb_tree_t *left, rb_tree_t *key, rb_tree_t *tree,
+			int height, int target)
+{
+	rb_tree_t *c = tree, *p = NULL;
+
+	while (c && (height > target || c->color == RED))
+	{
+		if (c->color == BLACK)
+			height--;
+		p = c;
+		c = c->left;
+	}
+	key->left = left;
+	key->right = c;
+	key->parent = p;
+	key->color = RED;
+	key->size = RB_SIZE(left) + RB_SIZE(c) + 1;
+	if (c)
+		c->parent = key;
+	if (left)
+		left->parent = key;
+	p->left = key;
+	rb_tree_resize(p, RB_SIZE(left) + 1);
+	rb_insert_fixup(&tree, key);
+	return (tree);
+}
+
+/**
+ * rb_tree_join - joins two Red-Black trees around a middle node
+ *
+ * Every value of @left must be smaller than @key->n, and every value of
+ * @right larger. The node is spliced in at the depth where both black
+ * heights match and the insert fixup repairs the colors, so the join costs
+ * O(log(n)) and allocates nothing.
+ *
+ * @left: tree holding the smaller values, may be NULL
+ * @key: detached node holding the middle value
+ * @right: tree holding the larger values, may be NULL
+ *
+ * Return: pointer to root node of the joined tree
+ */
+rb_tree_t *rb_tree_join(rb_tree_t *left, rb_tree_t *key, rb_tree_t *right)
+{
+	int hl, hr;
+
+	if (left)
+		left->parent = NULL, left->color = BLACK;
+	if (right)
+		right->parent = NULL, right->color = BLACK;
+	hl = rb_black_height(left);
+	hr = rb_black_height(right);
+	if (hl > hr)
+		return (rb_join_right(left, key, right, hl, hr));
+	if (hr > hl)
+		return (rb_join_left(left, key, right, hr, hl));
+
+	key->parent = NULL;
+	key->left = left;
+	key->right = right;
+	key->color = BLACK;
+	key->size = RB_SIZE(left) + RB_SIZE(right) + 1;
+	if (left)
+		left->parent = key;
+	if (right)
+		right->parent = key;
+	return (key);
+}
+
+/**
+ * rb_tree_join2 - concatenates two Red-Black trees
+ *
+ * The largest node of @left is unlinked and used as the middle node of
+ * rb_tree_join.
+ *
+ * @left: tree holding the smaller values, may be NULL
+ * @right: tree holding the larger values, may be NULL
+ *
+ * Return: pointer to root node of the joined tree
+ */
+rb_tree_t *rb_tree_join2(rb_tree_t *left, rb_tree_t *right)
+{
+	rb_tree_t *max;
+
+	if (left == NULL)
+		return (right);
+	if (right == NULL)
+		return (left);
+
+	left->parent = NULL;
+	left->color = BLACK;
+	for (max = left; max->right; max = max->right)
+		;
+	left = rb_tree_delete(left, max);
+	return (rb_tree_join(left, max, right));
+}
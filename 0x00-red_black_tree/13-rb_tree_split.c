@@ -0,0 +1,71 @@
+#include "rb_trees.h"
+
+/**
+ * rb_tree_detach - cuts a node off its subtrees
+ *
+ * @node: node to detach, it becomes a leaf of size 1
+ * @left: set to the former left subtree, as a standalone tree
+ * @right: set to the former right subtree, as a standalone tree
+ */
+void rb_tree_detach(rb_tree_t *node, rb_tree_t **left, rb_tree_t **right)
+{
+	*left = node->left;
+	*right = node->right;
+	if (*left)
+		(*left)->parent = NULL;
+	if (*right)
+		(*right)->parent = NULL;
+	node->parent = NULL;
+	node->left = NULL;
+	node->right = NULL;
+	node->size = 1;
+}
+
+/**
+ * rb_tree_split - splits a Red-Black tree around a value
+ *
+ * The nodes on the search path for @n are detached and joined back onto
+ * the left or right result, so the split costs O(log(n)) and allocates
+ * nothing. @tree must not be used afterwards.
+ *
+ * @tree: pointer to root node of the tree to split
+ * @n: value to split around
+ * @left: set to the tree holding the values smaller than @n
+ * @right: set to the tree holding the values larger than @n
+ *
+ * Return: the detached node holding @n, or NULL if @n was not in the tree
+ */
+rb_tree_t *rb_tree_split(rb_tree_t *tree, int n, rb_tree_t **left,
+			 rb_tree_t **right)
+{
+	rb_tree_t *l, *r, *found;
+
+	if (tree == NULL)
+	{
+		*left = NULL;
+		*right = NULL;
+		return (NULL);
+	}
+	rb_tree_detach(tree, &l, &r);
+	if (n == tree->n)
+	{
+		*left = l;
+		*right = r;
+		if (l)
+			l->color = BLACK;
+		if (r)
+			r->color = BLACK;
+		return (tree);
+	}
+	if (n < tree->n)
+	{
+		found = rb_tree_split(l, n, left, &l);
+		*right = rb_tree_join(l, tree, r);
+	}
+	else
+	{
+		found = rb_tree_split(r, n, &r, right);
+		*left = rb_tree_join(l, tree, r);
+	}
+	return (found);
+}
@@ -0,0 +1,145 @@
+#include "rb_trees.h"
+
+/**
+ * rb_union_rec - merges two Red-Black trees into their union
+ *
+ * @a: first tree, consumed
+ * @b: second tree, consumed, duplicates of @a are freed
+ * @depth: recursion depth, used to bound the number of threads
+ *
+ * Return: pointer to root node of the union
+ */
+rb_tree_t *rb_union_rec(rb_tree_t *a, rb_tree_t *b, int depth)
+{
+	rb_setop_t lo, hi;
+	size_t total;
+
+	if (a == NULL)
+		return (b);
+	if (b == NULL)
+		return (a);
+
+	total = a->size + b->size;
+	free(rb_tree_split(b, a->n, &lo.b, &hi.b));
+	rb_tree_detach(a, &lo.a, &hi.a);
+	lo.op = hi.op = rb_union_rec;
+	lo.depth = hi.depth = depth + 1;
+	rb_setop_fork(&lo, &hi, total);
+	return (rb_tree_join(lo.result, a, hi.result));
+}
+
+/**
+ * rb_intersection_rec - reduces two Red-Black trees to their intersection
+ *
+ * @a: first tree, consumed
+ * @b: second tree, consumed
+ * @depth: recursion depth, used to bound the number of threads
+ *
+ * Return: pointer to root node of the intersection
+ */
+rb_tree_t *rb_intersection_rec(rb_tree_t *a, rb_tree_t *b, int depth)
+{
+	rb_setop_t lo, hi;
+	rb_tree_t *dup;
+	size_t total;
+
+	if (a == NULL || b == NULL)
+	{
+		rb_build_free(a);
+		rb_build_free(b);
+		return (NULL);
+	}
+
+	total = a->size + b->size;
+	dup = rb_tree_split(b, a->n, &lo.b, &hi.b);
+	rb_tree_detach(a, &lo.a, &hi.a);
+	lo.op = hi.op = rb_intersection_rec;
+	lo.depth = hi.depth = depth + 1;
+	rb_setop_fork(&lo, &hi, total);
+	if (dup)
+	{
+		free(dup);
+		return (rb_tree_join(lo.result, a, hi.result));
+	}
+	free(a);
+	return (rb_tree_join2(lo.result, hi.result));
+}
+
+/**
+ * rb_difference_rec - removes the values of a Red-Black tree from another
+ *
+ * @a: tree to remove values from, consumed
+ * @b: values to remove, consumed
+ * @depth: recursion depth, used to bound the number of threads
+ *
+ * Return: pointer to root node of the difference
+ */
+rb_tree_t *rb_difference_rec(rb_tree_t *a, rb_tree_t *b, int depth)
+{
+	rb_setop_t lo, hi;
+	size_t total;
+
+	if (a == NULL || b == NULL)
+	{
+		rb_build_free(b);
+		return (a);
+	}
+
+	total = a->size + b->size;
+	free(rb_tree_split(a, b->n, &lo.a, &hi.a));
+	rb_tree_detach(b, &lo.b, &hi.b);
+	free(b);
+	lo.op = hi.op = rb_difference_rec;
+	lo.depth = hi.depth = depth + 1;
+	rb_setop_fork(&lo, &hi, total);
+	return (rb_tree_join2(lo.result, hi.result));
+}
+
+/**
+ * rb_tree_union - computes the union of two Red-Black trees
+ *
+ * Both trees are consumed: their nodes are reused for the result and
+ * duplicates are freed, so the nodes must come from rb_tree_node.
+ *
+ * @a: first tree
+ * @b: second tree
+ *
+ * Return: pointer to root node of the union
+ */
+rb_tree_t *rb_tree_union(rb_tree_t *a, rb_tree_t *b)
+{
+	return (rb_union_rec(a, b, 0));
+}
+
+/**
+ * rb_tree_intersection - computes the intersection of two Red-Black trees
+ *
+ * Both trees are consumed: common nodes of @a are reused for the result and
+ * every other node is freed, so the nodes must come from rb_tree_node.
+ *
+ * @a: first tree
+ * @b: second tree
+ *
+ * Return: pointer to root node of the intersection
+ */
+rb_tree_t *rb_tree_intersection(rb_tree_t *a, rb_tree_t *b)
+{
+	return (rb_intersection_rec(a, b, 0));
+}
+
+/**
+ * rb_tree_difference - computes the values of a tree missing from another
+ *
+ * Both trees are consumed: the remaining nodes of @a are reused for the
+ * result and every other node is freed, so the nodes must come from
+ * rb_tree_node.
+ *
+ * @a: tree to remove values from
+ * @b: values to remove
+ *
+ * Return: pointer to root node of the difference
+ */
+rb_tree_t *rb_tree_difference(rb_tree_t *a, rb_tree_t *b)
+{
+	return (rb_difference_rec(a, b, 0));
+}
@@ -0,0 +1,146 @@
+#include "rb_compact.h"
+
+/**
+ * rbc_tree_create - allocates an empty compact Red-Black tree
+ *
+ * @capacity: number of values to reserve room for
+ *
+ * Return: pointer to the created tree, or NULL on failure
+ */
+rbc_tree_t *rbc_tree_create(size_t capacity)
+{
+	rbc_tree_t *tree = NULL;
+
+	if (capacity < 16)
+		capacity = 16;
+	if (capacity >= RBC_MAX_NODES)
+		return (NULL);
+	tree = malloc(sizeof(rbc_tree_t));
+	if (tree == NULL)
+		return (NULL);
+
+	tree->nodes = malloc(sizeof(rbc_node_t) * (capacity + 1));
+	tree->keys = malloc(sizeof(int) * (capacity + 1));
+	if (tree->nodes == NULL || tree->keys == NULL)
+	{
+		rbc_tree_delete(tree);
+		return (NULL);
+	}
+	tree->nodes[RBC_NIL].left = RBC_NIL;
+	tree->nodes[RBC_NIL].right = RBC_NIL;
+	tree->nodes[RBC_NIL].link = BLACK;
+	tree->keys[RBC_NIL] = 0;
+	tree->root = RBC_NIL;
+	tree->used = 1;
+	tree->capacity = capacity + 1;
+	tree->free_list = RBC_NIL;
+	tree->count = 0;
+	return (tree);
+}
+
+/**
+ * rbc_tree_delete - frees a compact Red-Black tree
+ *
+ * @tree: pointer to the tree
+ */
+void rbc_tree_delete(rbc_tree_t *tree)
+{
+	if (tree == NULL)
+		return;
+	free(tree->nodes);
+	free(tree->keys);
+	free(tree);
+}
+
+/**
+ * rbc_tree_node - hands out a red, unlinked node slot
+ *
+ * Removed slots are reused first. When the arrays are full their capacity
+ * is doubled; node indices stay valid across the move.
+ *
+ * @tree: pointer to the tree
+ * @value: value to store in the node
+ *
+ * Return: index of the node, or RBC_NIL on failure
+ */
+uint32_t rbc_tree_node(rbc_tree_t *tree, int value)
+{
+	uint32_t x = tree->free_list, capacity;
+	rbc_node_t *nodes;
+	int *keys;
+
+	if (x != RBC_NIL)
+		tree->free_list = RBC_L(tree, x);
+	else
+	{
+		if (tree->used == tree->capacity)
+		{
+			if (tree->capacity > RBC_MAX_NODES / 2)
+				return (RBC_NIL);
+			capacity = tree->capacity * 2;
+			nodes = realloc(tree->nodes, sizeof(rbc_node_t) * capacity);
+			if (nodes == NULL)
+				return (RBC_NIL);
+			tree->nodes = nodes;
+			keys = realloc(tree->keys, sizeof(int) * capacity);
+			if (keys == NULL)
+				return (RBC_NIL);
+			tree->keys = keys;
+			tree->capacity = capacity;
+		}
+		x = tree->used++;
+	}
+	tree->keys[x] = value;
+	tree->nodes[x].left = RBC_NIL;
+	tree->nodes[x].right = RBC_NIL;
+	tree->nodes[x].link = RED;
+	return (x);
+}
+
+/**
+ * rbc_rotate_left - rotates subtree to left
+ *
+ * @tree: pointer to the tree
+ * @x: index of the node to rotate
+ */
+void rbc_rotate_left(rbc_tree_t *tree, uint32_t x)
+{
+	uint32_t y = RBC_R(tree, x), p = RBC_P(tree, x);
+
+	RBC_R(tree, x) = RBC_L(tree, y);
+	if (RBC_L(tree, y) != RBC_NIL)
+		RBC_SET_P(tree, RBC_L(tree, y), x);
+	RBC_SET_P(tree, y, p);
+	if (p == RBC_NIL)
+		tree->root = y;
+	else if (x == RBC_L(tree, p))
+		RBC_L(tree, p) = y;
+	else
+		RBC_R(tree, p) = y;
+	RBC_L(tree, y) = x;
+	RBC_SET_P(tree, x, y);
+}
+
+/**
+ * rbc_rotate_right - rotates subtree to right
+ *
+ * @tree: pointer to the tree
+ * @y: index of the node to rotate
+ */
+void rbc_rotate_right(rbc_tree_t *tree, uint32_t y)
+{
+	uint32_t x = RBC_L(tree, y), p = RBC_P(tree, y);
+
+	RBC_L(tree, y) = RBC_R(tree, x);
+	if (RBC_R(tree, x) != RBC_NIL)
+		RBC_SET_P(tree, RBC_R(tree, x), y);
+	RBC_SET_P(tree, x, p);
+	if (p == RBC_NIL)
+		tree->root = x;
+	else if (y == RBC_L(tree, p))
+		RBC_L(tree, p) = x;
+	else
+		RBC_R(tree, p) = x;
+	RBC_R(tree, x) = y;
+	RBC_SET_P(tree, y, x);
+}
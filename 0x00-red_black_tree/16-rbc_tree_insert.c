@@ -0,0 +1,102 @@
+#include "rb_compact.h"
+
+/**
+ * rbc_tree_find - looks a value up in a compact Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @value: value to search for
+ *
+ * Return: index of the node holding @value, or RBC_NIL if absent
+ */
+uint32_t rbc_tree_find(const rbc_tree_t *tree, int value)
+{
+	uint32_t x = tree->root;
+
+	while (x != RBC_NIL && tree->keys[x] != value)
+	{
+		if (value < tree->keys[x])
+			x = RBC_L(tree, x);
+		else
+			x = RBC_R(tree, x);
+	}
+	return (x);
+}
+
+/**
+ * rbc_tree_insert - inserts a value in a compact Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @value: the value to insert
+ *
+ * Return: index of the created node, or RBC_NIL on failure or if @value is
+ *         already in the tree
+ */
+uint32_t rbc_tree_insert(rbc_tree_t *tree, int value)
+{
+	uint32_t x, y = RBC_NIL, z;
+
+	if (tree == NULL)
+		return (RBC_NIL);
+
+	for (x = tree->root; x != RBC_NIL;)
+	{
+		y = x;
+		if (tree->keys[x] == value)
+			return (RBC_NIL);
+		if (value < tree->keys[x])
+			x = RBC_L(tree, x);
+		else
+			x = RBC_R(tree, x);
+	}
+	z = rbc_tree_node(tree, value);
+	if (z == RBC_NIL)
+		return (RBC_NIL);
+
+	RBC_SET_P(tree, z, y);
+	if (y == RBC_NIL)
+		tree->root = z;
+	else if (value < tree->keys[y])
+		RBC_L(tree, y) = z;
+	else
+		RBC_R(tree, y) = z;
+	rbc_insert_fixup(tree, z);
+	tree->count++;
+	return (z);
+}
+
+/**
+ * rbc_insert_fixup - rotate nodes and recolor to fix violation
+ *
+ * @tree: pointer to the tree
+ * @z: index of the new node
+ */
+void rbc_insert_fixup(rbc_tree_t *tree, uint32_t z)
+{
+	uint32_t p, g, y;
+
+	while (RBC_COLOR(tree, RBC_P(tree, z)) == RED)
+	{
+		p = RBC_P(tree, z);
+		g = RBC_P(tree, p);
+		y = p == RBC_L(tree, g) ? RBC_R(tree, g) : RBC_L(tree, g);
+		if (RBC_COLOR(tree, y) == RED)
+		{
+			RBC_SET_COLOR(tree, p, BLACK);
+			RBC_SET_COLOR(tree, y, BLACK);
+			RBC_SET_COLOR(tree, g, RED);
+			z = g;
+			continue;
+		}
+		if (p == RBC_L(tree, g) && z == RBC_R(tree, p))
+			rbc_rotate_left(tree, p), z = p, p = RBC_P(tree, z);
+		else if (p == RBC_R(tree, g) && z == RBC_L(tree, p))
+			rbc_rotate_right(tree, p), z = p, p = RBC_P(tree, z);
+		RBC_SET_COLOR(tree, p, BLACK);
+		RBC_SET_COLOR(tree, g, RED);
+		if (p == RBC_L(tree, g))
+			rbc_rotate_right(tree, g);
+		else
+			rbc_rotate_left(tree, g);
+	}
+	RBC_SET_COLOR(tree, tree->root, BLACK);
+}
@@ -0,0 +1,169 @@
+#include "rb_compact.h"
+
+/**
+ * rbc_transplant - replaces one subtree as a child of its parent with
+ *                  another subtree
+ *
+ * @tree: pointer to the tree
+ * @u: index of the root of the subtree to replace
+ * @v: index of the subtree to replace with, may be the sentinel
+ */
+void rbc_transplant(rbc_tree_t *tree, uint32_t u, uint32_t v)
+{
+	uint32_t p = RBC_P(tree, u);
+
+	if (p == RBC_NIL)
+		tree->root = v;
+	else if (u == RBC_L(tree, p))
+		RBC_L(tree, p) = v;
+	else
+		RBC_R(tree, p) = v;
+	RBC_SET_P(tree, v, p);
+}
+
+/**
+ * rbc_tree_remove - removes a value from a compact Red-Black tree
+ *
+ * The freed slot is kept for the next insertion.
+ *
+ * @tree: pointer to the tree
+ * @value: value to remove
+ *
+ * Return: 1 if the value was removed, 0 if it was not in the tree
+ */
+int rbc_tree_remove(rbc_tree_t *tree, int value)
+{
+	uint32_t z, y, x;
+	rb_color_t og_color;
+
+	z = tree ? rbc_tree_find(tree, value) : RBC_NIL;
+	if (z == RBC_NIL)
+		return (0);
+	y = z;
+	og_color = RBC_COLOR(tree, z);
+	if (RBC_L(tree, z) == RBC_NIL || RBC_R(tree, z) == RBC_NIL)
+	{
+		x = RBC_L(tree, z) == RBC_NIL ? RBC_R(tree, z) : RBC_L(tree, z);
+		rbc_transplant(tree, z, x);
+	}
+	else
+	{
+		for (y = RBC_R(tree, z); RBC_L(tree, y) != RBC_NIL;)
+			y = RBC_L(tree, y);
+		og_color = RBC_COLOR(tree, y);
+		x = RBC_R(tree, y);
+		RBC_SET_P(tree, x, y);
+		if (RBC_P(tree, y) != z)
+		{
+			rbc_transplant(tree, y, x);
+			RBC_R(tree, y) = RBC_R(tree, z);
+			RBC_SET_P(tree, RBC_R(tree, y), y);
+		}
+		rbc_transplant(tree, z, y);
+		RBC_L(tree, y) = RBC_L(tree, z);
+		RBC_SET_P(tree, RBC_L(tree, y), y);
+		RBC_SET_COLOR(tree, y, RBC_COLOR(tree, z));
+	}
+	if (og_color == BLACK)
+		rbc_delete_fixup(tree, x);
+	RBC_L(tree, z) = tree->free_list;
+	tree->free_list = z;
+	tree->count--;
+	return (1);
+}
+
+/**
+ * rbc_delete_fixup - restores red-black properties after a removal
+ *
+ * @tree: pointer to the tree
+ * @x: index of the node to fix, may be the sentinel
+ */
+void rbc_delete_fixup(rbc_tree_t *tree, uint32_t x)
+{
+	while (x != tree->root && RBC_COLOR(tree, x) == BLACK)
+	{
+		if (x == RBC_L(tree, RBC_P(tree, x)))
+			x = rbc_delete_fix_right(tree, x);
+		else
+			x = rbc_delete_fix_left(tree, x);
+	}
+	RBC_SET_COLOR(tree, x, BLACK);
+}
+
+/**
+ * rbc_delete_fix_left - fixes a right child using its left sibling
+ *
+ * @tree: pointer to the tree
+ * @x: index of the node to fix
+ *
+ * Return: index of the next node to fix
+ */
+uint32_t rbc_delete_fix_left(rbc_tree_t *tree, uint32_t x)
+{
+	uint32_t p = RBC_P(tree, x), w = RBC_L(tree, p);
+
+	if (RBC_COLOR(tree, w) == RED)
+	{
+		RBC_SET_COLOR(tree, w, BLACK);
+		RBC_SET_COLOR(tree, p, RED);
+		rbc_rotate_right(tree, p);
+		w = RBC_L(tree, p);
+	}
+	if (RBC_COLOR(tree, RBC_L(tree, w)) == BLACK &&
+	    RBC_COLOR(tree, RBC_R(tree, w)) == BLACK)
+	{
+		RBC_SET_COLOR(tree, w, RED);
+		return (p);
+	}
+	if (RBC_COLOR(tree, RBC_L(tree, w)) == BLACK)
+	{
+		RBC_SET_COLOR(tree, RBC_R(tree, w), BLACK);
+		RBC_SET_COLOR(tree, w, RED);
+		rbc_rotate_left(tree, w);
+		w = RBC_L(tree, p);
+	}
+	RBC_SET_COLOR(tree, w, RBC_COLOR(tree, p));
+	RBC_SET_COLOR(tree, p, BLACK);
+	RBC_SET_COLOR(tree, RBC_L(tree, w), BLACK);
+	rbc_rotate_right(tree, p);
+	return (tree->root);
+}
+
+/**
+ * rbc_delete_fix_right - fixes a left child using its right sibling
+ *
+ * @tree: pointer to the tree
+ * @x: index of the node to fix
+ *
+ * Return: index of the next node to fix
+ */
+uint32_t rbc_delete_fix_right(rbc_tree_t *tree, uint32_t x)
+{
+	uint32_t p = RBC_P(tree, x), w = RBC_R(tree, p);
+
+	if (RBC_COLOR(tree, w) == RED)
+	{
+		RBC_SET_COLOR(tree, w, BLACK);
+		RBC_SET_COLOR(tree, p, RED);
+		rbc_rotate_left(tree, p);
+		w = RBC_R(tree, p);
+	}
+	if (RBC_COLOR(tree, RBC_L(tree, w)) == BLACK &&
+	    RBC_COLOR(tree, RBC_R(tree, w)) == BLACK)
+	{
+		RBC_SET_COLOR(tree, w, RED);
+		return (p);
+	}
+	if (RBC_COLOR(tree, RBC_R(tree, w)) == BLACK)
+	{
+		RBC_SET_COLOR(tree, RBC_L(tree, w), BLACK);
+		RBC_SET_COLOR(tree, w, RED);
+		rbc_rotate_right(tree, w);
+		w = RBC_R(tree, p);
+	}
+	RBC_SET_COLOR(tree, w, RBC_COLOR(tree, p));
+	RBC_SET_COLOR(tree, p, BLACK);
+	RBC_SET_COLOR(tree, RBC_R(tree, w), BLACK);
+	rbc_rotate_left(tree, p);
+	return (tree->root);
+}
@@ -0,0 +1,55 @@
+#include "rb_compact.h"
+
+/**
+ * rbc_tree_is_valid - checks if a compact tree is a valid Red-Black Tree
+ *
+ * @tree: pointer to the tree
+ *
+ * Return: 1 if tree is valid, otherwise 0
+ */
+int rbc_tree_is_valid(const rbc_tree_t *tree)
+{
+	if (tree == NULL || tree->root == RBC_NIL)
+		return (0);
+	if (RBC_COLOR(tree, tree->root) != BLACK ||
+	    RBC_COLOR(tree, RBC_NIL) != BLACK ||
+	    RBC_P(tree, tree->root) != RBC_NIL)
+		return (0);
+	return (rbc_check(tree, tree->root, NULL, NULL) > 0);
+}
+
+/**
+ * rbc_check - checks order, colors and links of a compact subtree
+ *
+ * @tree: pointer to the tree
+ * @x: index of the subtree root
+ * @min: every value must be greater than *@min, NULL for no lower bound
+ * @max: every value must be smaller than *@max, NULL for no upper bound
+ *
+ * Return: black height of the subtree, counting the sentinel, or 0 if the
+ *         subtree is invalid
+ */
+int rbc_check(const rbc_tree_t *tree, uint32_t x, const int *min,
+	      const int *max)
+{
+	uint32_t l, r;
+	int hl, hr;
+
+	if (x == RBC_NIL)
+		return (1);
+	l = RBC_L(tree, x);
+	r = RBC_R(tree, x);
+	if ((min && tree->keys[x] <= *min) || (max && tree->keys[x] >= *max))
+		return (0);
+	if ((l != RBC_NIL && RBC_P(tree, l) != x) ||
+	    (r != RBC_NIL && RBC_P(tree, r) != x))
+		return (0);
+	if (RBC_COLOR(tree, x) == RED &&
+	    (RBC_COLOR(tree, l) == RED || RBC_COLOR(tree, r) == RED))
+		return (0);
+	hl = rbc_check(tree, l, min, &tree->keys[x]);
+	hr = rbc_check(tree, r, &tree->keys[x], max);
+	if (hl == 0 || hl != hr)
+		return (0);
+	return (hl + (RBC_COLOR(tree, x) == BLACK));
+}
@@ -0,0 +1,159 @@
+#include "rb_kv.h"
+
+/**
+ * rb_kv_create - allocates an empty key/value Red-Black tree
+ *
+ * @type: kind of keys the tree stores
+ * @cmp: comparator for RB_KEY_PTR keys, ignored for the other types
+ *
+ * The search loop is chosen here for @type, so int and 64-bit keys are
+ * compared inline without branching on the key type at every node.
+ *
+ * Return: pointer to the created tree, or NULL on failure
+ */
+rb_kv_tree_t *rb_kv_create(rb_key_type_t type,
+			   int (*cmp)(const void *a, const void *b))
+{
+	rb_kv_tree_t *tree = NULL;
+
+	if (type == RB_KEY_PTR && cmp == NULL)
+		return (NULL);
+	tree = malloc(sizeof(rb_kv_tree_t));
+	if (tree == NULL)
+		return (NULL);
+
+	tree->root = NULL;
+	tree->type = type;
+	tree->cmp = cmp;
+	if (type == RB_KEY_INT)
+		tree->search = rb_kv_search_int;
+	else if (type == RB_KEY_INT64)
+		tree->search = rb_kv_search_int64;
+	else
+		tree->search = rb_kv_search_ptr;
+	return (tree);
+}
+
+/**
+ * rb_kv_free_nodes - frees the nodes of a key/value subtree
+ *
+ * The subtree is flattened with rb_tree_vine first, so it is freed in
+ * O(n) time and O(1) space.
+ *
+ * @tree: pointer to root node of the subtree
+ * @free_value: called on every value when not NULL
+ */
+void rb_kv_free_nodes(rb_tree_t *tree, void (*free_value)(void *value))
+{
+	rb_tree_t *next;
+	size_t count = 0;
+
+	for (tree = rb_tree_vine(tree, &count); tree; tree = next)
+	{
+		next = tree->right;
+		if (free_value)
+			free_value(RB_KV(tree)->value);
+		free(tree);
+	}
+}
+
+/**
+ * rb_kv_delete - frees a key/value Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @free_value: called on every value when not NULL
+ */
+void rb_kv_delete(rb_kv_tree_t *tree, void (*free_value)(void *value))
+{
+	if (tree == NULL)
+		return;
+	rb_kv_free_nodes(tree->root, free_value);
+	free(tree);
+}
+
+/**
+ * rb_kv_search_int - finds the link holding an int key in a key/value tree
+ *
+ * @tree: pointer to the tree
+ * @key: key to search for
+ * @parent: set to the parent of the returned link
+ *
+ * Return: pointer to the link holding the node with @key, or to the empty
+ *         link where it must be inserted
+ */
+rb_tree_t **rb_kv_search_int(rb_kv_tree_t *tree, rb_key_t key,
+			     rb_tree_t **parent)
+{
+	rb_tree_t **link = &tree->root;
+
+	*parent = NULL;
+	while (*link != NULL && (*link)->n != key.i)
+	{
+		*parent = *link;
+		if (key.i < (*link)->n)
+			link = &(*link)->left;
+		else
+			link = &(*link)->right;
+	}
+	return (link);
+}
+
+/**
+ * rb_kv_search_int64 - finds the link holding a 64-bit key in a key/value
+ *                      tree
+ *
+ * @tree: pointer to the tree
+ * @key: key to search for
+ * @parent: set to the parent of the returned link
+ *
+ * Return: pointer to the link holding the node with @key, or to the empty
+ *         link where it must be inserted
+ */
+rb_tree_t **rb_kv_search_int64(rb_kv_tree_t *tree, rb_key_t key,
+			       rb_tree_t **parent)
+{
+	rb_tree_t **link = &tree->root;
+
+	*parent = NULL;
+	while (*link != NULL && RB_KV(*link)->key.i64 != key.i64)
+	{
+		*parent = *link;
+		if (key.i64 < RB_KV(*link)->key.i64)
+			link = &(*link)->left;
+		else
+			link = &(*link)->right;
+	}
+	return (link);
+}
+
+/**
+ * rb_kv_search_ptr - finds the link holding a key in a key/value tree
+ *                    ordered by its comparator
+ *
+ * @tree: pointer to the tree
+ * @key: key to search for
+ * @parent: set to the parent of the returned link
+ *
+ * Return: pointer to the link holding the node with @key, or to the empty
+ *         link where it must be inserted
+ */
+rb_tree_t **rb_kv_search_ptr(rb_kv_tree_t *tree, rb_key_t key,
+			     rb_tree_t **parent)
+{
+	rb_tree_t **link = &tree->root;
+	int cmp;
+
+	*parent = NULL;
+	while (*link != NULL)
+	{
+		cmp = tree->cmp(key.ptr, RB_KV(*link)->key.ptr);
+		if (cmp == 0)
+			break;
+		*parent = *link;
+		if (cmp < 0)
+			link = &(*link)->left;
+		else
+			link = &(*link)->right;
+	}
+	return (link);
+}
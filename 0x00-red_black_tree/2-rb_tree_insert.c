@@ -10,38 +10,57 @@
  */
 rb_tree_t *rb_tree_insert(rb_tree_t **tree, int value)
 {
-	rb_tree_t *x = NULL;
-	rb_tree_t *y = NULL;
+	rb_tree_t **slot = NULL;
+	rb_tree_t *parent = NULL;
 	rb_tree_t *new = NULL;
 
 	if (!tree)
 		return (NULL);
 
-	x = *tree;
-	while (x != NULL)
-	{
-		y = x;
-		if (x->n == value)
-			return (NULL);
-		if (value < x->n)
-			x = x->left;
-		else if (value > x->n)
-			x = x->right;
-	}
-	new = rb_tree_node(y, value, RED);
+	slot = rb_tree_slot(tree, value, &parent);
+	if (!slot)
+		return (NULL);
+	new = rb_tree_node(parent, value, RED);
 	if (!new)
 		return (NULL);
 
-	if (y == NULL)
-		*tree = new;
-	else if (new->n < y->n)
-		y->left = new;
-	else
-		y->right = new;
+	*slot = new;
+	rb_tree_resize(parent, 1);
 	rb_insert_fixup(tree, new);
 	return (new);
 }
 
+/**
+ * rb_tree_slot - finds where a value belongs in a Red-Black Tree
+ *
+ * @tree: double pointer to root node of Red-Black tree
+ * @value: the value to look for
+ * @parent: set to the parent of the returned slot
+ *
+ * Return: pointer to the empty child pointer where @value must be linked,
+ *         or NULL if @value is already in the tree
+ */
+rb_tree_t **rb_tree_slot(rb_tree_t **tree, int value, rb_tree_t **parent)
+{
+	rb_tree_t **slot = tree;
+	size_t depth = 0;
+
+	*parent = NULL;
+	while (*slot != NULL)
+	{
+		RB_STAT(comparisons, 1);
+		RB_STAT_DEPTH(depth);
+		if ((*slot)->n == value)
+			return (NULL);
+		*parent = *slot;
+		if (value < (*slot)->n)
+			slot = &(*slot)->left;
+		else
+			slot = &(*slot)->right;
+	}
+	return (slot);
+}
+
 /**
  * rb_insert_fixup - rotate nodes and recolor to fix violation
  *
@@ -53,12 +72,13 @@ void rb_insert_fixup(rb_tree_t **tree, rb_tree_t *new)
 {
 	while (new->parent && new->parent->color == RED)
 	{
+		RB_STAT(fixups, 1);
 		if (new->parent->parent && new->parent == new->parent->parent->left)
 			new = rb_insert_fixup_RIGHT(tree, new);
 		else
 			new = rb_insert_fixup_LEFT(tree, new);
 	}
-	(*tree)->color = BLACK;
+	RB_RECOLOR(*tree, BLACK);
 }
 
 /**
@@ -76,9 +96,9 @@ rb_tree_t *rb_insert_fixup_LEFT(rb_tree_t **tree, rb_tree_t *new)
 	y = new->parent->parent->left;
 	if (y && y->color == RED)
 	{
-		new->parent->color = BLACK;
-		y->color = BLACK;
-		new->parent->parent->color = RED;
+		RB_RECOLOR(new->parent, BLACK);
+		RB_RECOLOR(y, BLACK);
+		RB_RECOLOR(new->parent->parent, RED);
 		new = new->parent->parent;
 	}
 	else
@@ -88,8 +108,8 @@ rb_tree_t *rb_insert_fixup_LEFT(rb_tree_t **tree, rb_tree_t *new)
 			new = new->parent;
 			rb_rotate_right(tree, new);
 		}
-		new->parent->color = BLACK;
-		new->parent->parent->color = RED;
+		RB_RECOLOR(new->parent, BLACK);
+		RB_RECOLOR(new->parent->parent, RED);
 		rb_rotate_left(tree, new->parent->parent);
 	}
 	return (new);
@@ -109,9 +129,9 @@ rb_tree_t *rb_insert_fixup_RIGHT(rb_tree_t **tree, rb_tree_t *new)
 	y = new->parent->parent->right;
 	if (y && y->color == RED)
 	{
-		new->parent->color = BLACK;
-		y->color = BLACK;
-		new->parent->parent->color = RED;
+		RB_RECOLOR(new->parent, BLACK);
+		RB_RECOLOR(y, BLACK);
+		RB_RECOLOR(new->parent->parent, RED);
 		new = new->parent->parent;
 	}
 	else
@@ -121,8 +141,8 @@ rb_tree_t *rb_insert_fixup_RIGHT(rb_tree_t **tree, rb_tree_t *new)
 			new = new->parent;
 			rb_rotate_left(tree, new);
 		}
-		new->parent->color = BLACK;
-		new->parent->parent->color = RED;
+		RB_RECOLOR(new->parent, BLACK);
+		RB_RECOLOR(new->parent->parent, RED);
 		rb_rotate_right(tree, new->parent->parent);
 	}
 	return (new);
@@ -138,6 +158,7 @@ void rb_rotate_left(rb_tree_t **tree, rb_tree_t *x)
 {
 	rb_tree_t *y = NULL;
 
+	RB_STAT(rotations, 1);
 	y = x->right;
 	x->right = y->left;
 	if (y->left)
@@ -151,6 +172,8 @@ void rb_rotate_left(rb_tree_t **tree, rb_tree_t *x)
 		x->parent->right = y;
 	y->left = x;
 	x->parent = y;
+	y->size = x->size;
+	x->size = RB_SIZE(x->left) + RB_SIZE(x->right) + 1;
 }
 
 /**
@@ -163,6 +186,7 @@ void rb_rotate_right(rb_tree_t **tree, rb_tree_t *y)
 {
 	rb_tree_t *x = NULL;
 
+	RB_STAT(rotations, 1);
 	x = y->left;
 	y->left = x->right;
 	if (x->right)
@@ -176,4 +200,19 @@ void rb_rotate_right(rb_tree_t **tree, rb_tree_t *y)
 		y->parent->right = x;
 	x->right = y;
 	y->parent = x;
+	x->size = y->size;
+	y->size = RB_SIZE(y->left) + RB_SIZE(y->right) + 1;
+}
+
+/**
+ * rb_tree_resize - adds a delta to the subtree size of a node and of all
+ *                  its ancestors
+ *
+ * @node: deepest node whose subtree gained or lost nodes
+ * @delta: number of nodes added, negative when nodes were removed
+ */
+void rb_tree_resize(rb_tree_t *node, long delta)
+{
+	for (; node != NULL; node = node->parent)
+		node->size += delta;
 }
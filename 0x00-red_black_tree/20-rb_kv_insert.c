@@ -0,0 +1,126 @@
+#include "rb_kv.h"
+
+/**
+ * rb_kv_insert - inserts a key/value pair in a key/value Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @key: key of the pair
+ * @value: value of the pair
+ *
+ * Return: pointer to the created node, or NULL on failure or if @key is
+ *         already in the tree
+ */
+rb_kv_node_t *rb_kv_insert(rb_kv_tree_t *tree, rb_key_t key, void *value)
+{
+	rb_tree_t **link, *parent;
+	rb_kv_node_t *new = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	link = tree->search(tree, key, &parent);
+	if (*link != NULL)
+		return (NULL);
+
+	new = malloc(sizeof(rb_kv_node_t));
+	if (new == NULL)
+		return (NULL);
+	new->node.parent = parent;
+	new->node.n = tree->type == RB_KEY_INT ? key.i : 0;
+	new->node.color = RED;
+	new->node.left = NULL;
+	new->node.right = NULL;
+	new->node.size = 1;
+	new->key = key;
+	new->value = value;
+
+	*link = &new->node;
+	rb_tree_resize(parent, 1);
+	rb_insert_fixup(&tree->root, &new->node);
+	return (new);
+}
+
+/**
+ * rb_kv_find - looks a key up in a key/value Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @key: key to search for
+ *
+ * Return: pointer to the node holding @key, or NULL if it is not in the tree
+ */
+rb_kv_node_t *rb_kv_find(rb_kv_tree_t *tree, rb_key_t key)
+{
+	rb_tree_t *parent;
+
+	if (tree == NULL)
+		return (NULL);
+	return (RB_KV(*tree->search(tree, key, &parent)));
+}
+
+/**
+ * rb_kv_remove - removes a key from a key/value Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @key: key to remove
+ * @value: if not NULL, set to the value that was stored with @key
+ *
+ * Return: 1 if the key was removed, 0 if it was not in the tree
+ */
+int rb_kv_remove(rb_kv_tree_t *tree, rb_key_t key, void **value)
+{
+	rb_kv_node_t *remove = rb_kv_find(tree, key);
+
+	if (remove == NULL)
+		return (0);
+	if (value)
+		*value = remove->value;
+	tree->root = rb_tree_delete(tree->root, &remove->node);
+	free(remove);
+	return (1);
+}
+
+/**
+ * rb_key_int - makes a key for a RB_KEY_INT tree
+ *
+ * @i: key value
+ *
+ * Return: the key
+ */
+rb_key_t rb_key_int(int i)
+{
+	rb_key_t key;
+
+	key.i64 = 0;
+	key.i = i;
+	return (key);
+}
+
+/**
+ * rb_key_int64 - makes a key for a RB_KEY_INT64 tree
+ *
+ * @i64: key value
+ *
+ * Return: the key
+ */
+rb_key_t rb_key_int64(int64_t i64)
+{
+	rb_key_t key;
+
+	key.i64 = i64;
+	return (key);
+}
+
+/**
+ * rb_key_ptr - makes a key for a RB_KEY_PTR tree
+ *
+ * @ptr: key handed to the comparator
+ *
+ * Return: the key
+ */
+rb_key_t rb_key_ptr(const void *ptr)
+{
+	rb_key_t key;
+
+	key.i64 = 0;
+	key.ptr = ptr;
+	return (key);
+}
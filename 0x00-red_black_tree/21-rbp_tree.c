@@ -0,0 +1,117 @@
+#include "rb_persist.h"
+
+/**
+ * rbp_retain - takes a reference on a version of a persistent tree
+ *
+ * The caller already holds a reference, so the count cannot reach 0 under
+ * it and a relaxed increment is enough.
+ *
+ * @root: root of the version, may be NULL for the empty version
+ *
+ * Return: @root
+ */
+rbp_node_t *rbp_retain(rbp_node_t *root)
+{
+	if (root)
+		__atomic_add_fetch(&root->ref, 1, __ATOMIC_RELAXED);
+	return (root);
+}
+
+/**
+ * rbp_release - drops a reference on a version of a persistent tree
+ *
+ * Nodes no longer reachable from any version are freed. Nodes shared
+ * with other versions only lose one reference. Counts are atomic, so
+ * readers may release old versions while a writer copies their nodes;
+ * only the thread whose decrement reaches 0 frees the node.
+ *
+ * @root: root of the version, may be NULL for the empty version
+ */
+void rbp_release(rbp_node_t *root)
+{
+	if (root == NULL ||
+	    __atomic_sub_fetch(&root->ref, 1, __ATOMIC_ACQ_REL) > 0)
+		return;
+	rbp_release(root->left);
+	rbp_release(root->right);
+	free(root);
+}
+
+/**
+ * rbp_find - looks a value up in a version of a persistent tree
+ *
+ * @root: root of the version
+ * @value: value to search for
+ *
+ * Return: pointer to the node holding @value, or NULL if it is absent
+ */
+const rbp_node_t *rbp_find(const rbp_node_t *root, int value)
+{
+	while (root && root->n != value)
+	{
+		if (value < root->n)
+			root = root->left;
+		else
+			root = root->right;
+	}
+	return (root);
+}
+
+/**
+ * rbp_own - makes the node behind a link private to an operation
+ *
+ * A shared node is copied and the link, which must belong to a private
+ * node or to the version being built, is pointed at the copy. Reference
+ * counts stay exact, so a failed operation can be released as is. The
+ * reference of the link is dropped with rbp_release, since a reader may
+ * have released every other one meanwhile.
+ *
+ * @op: running operation
+ * @link: link to the node
+ *
+ * Return: pointer to the private node, or NULL if the link is empty or an
+ *         allocation failed
+ */
+rbp_node_t *rbp_own(rbp_op_t *op, rbp_node_t **link)
+{
+	rbp_node_t *node = *link, *copy = NULL;
+
+	if (node == NULL || node->fresh)
+		return (node);
+	if (op->nb_fresh < RBP_MAX_FRESH)
+		copy = malloc(sizeof(rbp_node_t));
+	if (copy == NULL)
+	{
+		op->failed = 1;
+		return (NULL);
+	}
+	copy->n = node->n;
+	copy->color = node->color;
+	copy->left = node->left;
+	copy->right = node->right;
+	copy->ref = 1;
+	copy->fresh = 1;
+	rbp_retain(copy->left);
+	rbp_retain(copy->right);
+	*link = copy;
+	rbp_release(node);
+	op->fresh[op->nb_fresh++] = copy;
+	return (copy);
+}
+
+/**
+ * rbp_link - finds the link pointing to a node of the operation path
+ *
+ * @op: running operation
+ * @i: index of the node in the path
+ *
+ * Return: pointer to the link in the parent, or to the version root
+ */
+rbp_node_t **rbp_link(rbp_op_t *op, size_t i)
+{
+	if (i == 0)
+		return (&op->root);
+	if (op->path[i - 1]->left == op->path[i])
+		return (&op->path[i - 1]->left);
+	return (&op->path[i - 1]->right);
+}
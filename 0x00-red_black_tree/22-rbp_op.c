@@ -0,0 +1,98 @@
+#include "rb_persist.h"
+
+/**
+ * rbp_op_init - starts building a new version from an existing one
+ *
+ * @op: operation to initialize
+ * @root: root of the version to start from
+ */
+void rbp_op_init(rbp_op_t *op, rbp_node_t *root)
+{
+	op->root = rbp_retain(root);
+	op->depth = 0;
+	op->nb_fresh = 0;
+	op->failed = 0;
+}
+
+/**
+ * rbp_op_finish - publishes or discards the version built by an operation
+ *
+ * @op: operation to finish
+ * @version: set to the root of the new version on success
+ *
+ * Return: 1 on success, -1 if an allocation failed
+ */
+int rbp_op_finish(rbp_op_t *op, rbp_node_t **version)
+{
+	size_t i;
+
+	for (i = 0; i < op->nb_fresh; i++)
+		if (op->fresh[i])
+			op->fresh[i]->fresh = 0;
+	if (op->failed)
+	{
+		rbp_release(op->root);
+		return (-1);
+	}
+	*version = op->root;
+	return (1);
+}
+
+/**
+ * rbp_node - creates a private red leaf for an operation
+ *
+ * @op: running operation
+ * @value: value of the leaf
+ *
+ * Return: pointer to the leaf, or NULL on failure
+ */
+rbp_node_t *rbp_node(rbp_op_t *op, int value)
+{
+	rbp_node_t *node = NULL;
+
+	if (op->nb_fresh < RBP_MAX_FRESH)
+		node = malloc(sizeof(rbp_node_t));
+	if (node == NULL)
+	{
+		op->failed = 1;
+		return (NULL);
+	}
+	node->n = value;
+	node->color = RED;
+	node->ref = 1;
+	node->fresh = 1;
+	node->left = NULL;
+	node->right = NULL;
+	op->fresh[op->nb_fresh++] = node;
+	return (node);
+}
+
+/**
+ * rbp_rotate_left - rotates a private subtree to left
+ *
+ * @link: link to the subtree root; the root and its right child must be
+ *        private to the operation
+ */
+void rbp_rotate_left(rbp_node_t **link)
+{
+	rbp_node_t *x = *link, *y = x->right;
+
+	x->right = y->left;
+	y->left = x;
+	*link = y;
+}
+
+/**
+ * rbp_rotate_right - rotates a private subtree to right
+ *
+ * @link: link to the subtree root; the root and its left child must be
+ *        private to the operation
+ */
+void rbp_rotate_right(rbp_node_t **link)
+{
+	rbp_node_t *y = *link, *x = y->left;
+
+	y->left = x->right;
+	x->right = y;
+	*link = x;
+}
@@ -0,0 +1,87 @@
+#include "rb_persist.h"
+
+/**
+ * rbp_insert - inserts a value in a persistent Red-Black tree
+ *
+ * Only the search path and the uncles recolored by the fixup are copied;
+ * every other node is shared with @root, which stays valid and unchanged.
+ *
+ * @root: root of the version to insert into
+ * @value: the value to insert
+ * @version: set to the root of the new version, owned by the caller
+ *
+ * Return: 1 if @value was inserted, 0 if it was already present (@version
+ *         is then a new reference to @root), -1 on failure
+ */
+int rbp_insert(rbp_node_t *root, int value, rbp_node_t **version)
+{
+	rbp_op_t op;
+	rbp_node_t **link, *node;
+
+	if (version == NULL)
+		return (-1);
+	if (rbp_find(root, value))
+	{
+		*version = rbp_retain(root);
+		return (0);
+	}
+	rbp_op_init(&op, root);
+	for (link = &op.root; *link;)
+	{
+		node = rbp_own(&op, link);
+		if (node == NULL)
+			return (rbp_op_finish(&op, version));
+		op.path[op.depth++] = node;
+		link = value < node->n ? &node->left : &node->right;
+	}
+	node = rbp_node(&op, value);
+	if (node == NULL)
+		return (rbp_op_finish(&op, version));
+	*link = node;
+	op.path[op.depth++] = node;
+	rbp_insert_fixup(&op);
+	return (rbp_op_finish(&op, version));
+}
+
+/**
+ * rbp_insert_fixup - rotate nodes and recolor to fix violation
+ *
+ * @op: running insertion, its path ends with the new node
+ */
+void rbp_insert_fixup(rbp_op_t *op)
+{
+	size_t i = op->depth - 1;
+	rbp_node_t *p, *g, **uncle, **link;
+	int left;
+
+	while (i >= 2 && op->path[i - 1]->color == RED)
+	{
+		p = op->path[i - 1];
+		g = op->path[i - 2];
+		left = p == g->left;
+		uncle = left ? &g->right : &g->left;
+		if (*uncle && (*uncle)->color == RED)
+		{
+			if (rbp_own(op, uncle) == NULL)
+				return;
+			p->color = BLACK;
+			(*uncle)->color = BLACK;
+			g->color = RED;
+			i -= 2;
+			continue;
+		}
+		if (left && op->path[i] == p->right)
+			rbp_rotate_left(&g->left), p = op->path[i];
+		else if (!left && op->path[i] == p->left)
+			rbp_rotate_right(&g->right), p = op->path[i];
+		p->color = BLACK;
+		g->color = RED;
+		link = rbp_link(op, i - 2);
+		if (left)
+			rbp_rotate_right(link);
+		else
+			rbp_rotate_left(link);
+		break;
+	}
+	op->root->color = BLACK;
+}
@@ -0,0 +1,211 @@
+#include "rb_persist.h"
+
+/**
+ * rbp_remove - removes a value from a persistent Red-Black tree
+ *
+ * Only the search path and the siblings touched by the fixup are copied;
+ * every other node is shared with @root, which stays valid and unchanged.
+ *
+ * @root: root of the version to remove from
+ * @value: the value to remove
+ * @version: set to the root of the new version, owned by the caller
+ *
+ * Return: 1 if @value was removed, 0 if it was absent (@version is then a
+ *         new reference to @root), -1 on failure
+ */
+int rbp_remove(rbp_node_t *root, int value, rbp_node_t **version)
+{
+	rbp_op_t op;
+	rbp_node_t **link = NULL, *node = NULL, *z;
+
+	if (version == NULL)
+		return (-1);
+	if (rbp_find(root, value) == NULL)
+	{
+		*version = rbp_retain(root);
+		return (0);
+	}
+	rbp_op_init(&op, root);
+	for (link = &op.root; node == NULL || node->n != value;)
+	{
+		node = rbp_own(&op, link);
+		if (node == NULL)
+			return (rbp_op_finish(&op, version));
+		op.path[op.depth++] = node;
+		link = value < node->n ? &node->left : &node->right;
+	}
+	z = node;
+	if (z->left && z->right)
+	{
+		for (link = &z->right; node == z || node->left; link = &node->left)
+		{
+			node = rbp_own(&op, link);
+			if (node == NULL)
+				return (rbp_op_finish(&op, version));
+			op.path[op.depth++] = node;
+		}
+		z->n = node->n;
+	}
+	rbp_unlink(&op);
+	return (rbp_op_finish(&op, version));
+}
+
+/**
+ * rbp_unlink - frees the last node of the path, which has at most one
+ *              child, and restores the red-black properties
+ *
+ * @op: running removal
+ */
+void rbp_unlink(rbp_op_t *op)
+{
+	rbp_node_t *m = op->path[--op->depth], *child, **link;
+	rb_color_t color = m->color;
+	size_t i;
+	int left;
+
+	child = m->left ? m->left : m->right;
+	link = rbp_link(op, op->depth);
+	left = op->depth > 0 && link == &op->path[op->depth - 1]->left;
+	*link = child;
+	for (i = 0; i < op->nb_fresh; i++)
+		if (op->fresh[i] == m)
+			op->fresh[i] = NULL;
+	free(m);
+	if (color == RED)
+		return;
+	if (child && child->color == RED)
+	{
+		child = rbp_own(op, link);
+		if (child)
+			child->color = BLACK;
+		return;
+	}
+	rbp_delete_fixup(op, left);
+}
+
+/**
+ * rbp_delete_fixup - restores red-black properties after a removal
+ *
+ * @op: running removal, the doubly black node is a child of the last node
+ *      of its path
+ * @left: 1 if the doubly black node is a left child
+ */
+void rbp_delete_fixup(rbp_op_t *op, int left)
+{
+	rbp_node_t *p, *x;
+
+	for (;;)
+	{
+		if (op->depth == 0)
+		{
+			x = op->root;
+			break;
+		}
+		p = op->path[op->depth - 1];
+		x = left ? p->left : p->right;
+		if (x && x->color == RED)
+			break;
+		if (left ? rbp_delete_fix_right(op) : rbp_delete_fix_left(op))
+			return;
+		op->depth--;
+		left = op->depth > 0 && op->path[op->depth - 1]->left == p;
+	}
+	if (x)
+		x->color = BLACK;
+}
+
+/**
+ * rbp_delete_fix_left - fixes a right child using its left sibling
+ *
+ * @op: running removal, the last node of its path is the parent
+ *
+ * Return: 0 if the parent becomes the doubly black node, 1 when done
+ */
+int rbp_delete_fix_left(rbp_op_t *op)
+{
+	rbp_node_t *p = op->path[op->depth - 1], *w;
+
+	w = rbp_own(op, &p->left);
+	if (w == NULL)
+		return (1);
+	if (w->color == RED)
+	{
+		w->color = BLACK;
+		p->color = RED;
+		rbp_rotate_right(rbp_link(op, op->depth - 1));
+		op->path[op->depth - 1] = w;
+		op->path[op->depth++] = p;
+		w = rbp_own(op, &p->left);
+		if (w == NULL)
+			return (1);
+	}
+	if (IS_BLACK(w->left) && IS_BLACK(w->right))
+	{
+		w->color = RED;
+		return (0);
+	}
+	if (IS_BLACK(w->left))
+	{
+		if (rbp_own(op, &w->right) == NULL)
+			return (1);
+		w->right->color = BLACK;
+		w->color = RED;
+		rbp_rotate_left(&p->left);
+		w = p->left;
+	}
+	if (rbp_own(op, &w->left) == NULL)
+		return (1);
+	w->color = p->color;
+	p->color = BLACK;
+	w->left->color = BLACK;
+	rbp_rotate_right(rbp_link(op, op->depth - 1));
+	return (1);
+}
+
+/**
+ * rbp_delete_fix_right - fixes a left child using its right sibling
+ *
+ * @op: running removal, the last node of its path is the parent
+ *
+ * Return: 0 if the parent becomes the doubly black node, 1 when done
+ */
+int rbp_delete_fix_right(rbp_op_t *op)
+{
+	rbp_node_t *p = op->path[op->depth - 1], *w;
+
+	w = rbp_own(op, &p->right);
+	if (w == NULL)
+		return (1);
+	if (w->color == RED)
+	{
+		w->color = BLACK;
+		p->color = RED;
+		rbp_rotate_left(rbp_link(op, op->depth - 1));
+		op->path[op->depth - 1] = w;
+		op->path[op->depth++] = p;
+		w = rbp_own(op, &p->right);
+		if (w == NULL)
+			return (1);
+	}
+	if (IS_BLACK(w->left) && IS_BLACK(w->right))
+	{
+		w->color = RED;
+		return (0);
+	}
+	if (IS_BLACK(w->right))
+	{
+		if (rbp_own(op, &w->left) == NULL)
+			return (1);
+		w->left->color = BLACK;
+		w->color = RED;
+		rbp_rotate_right(&p->right);
+		w = p->right;
+	}
+	if (rbp_own(op, &w->right) == NULL)
+		return (1);
+	w->color = p->color;
+	p->color = BLACK;
+	w->right->color = BLACK;
+	rbp_rotate_left(rbp_link(op, op->depth - 1));
+	return (1);
+}
@@ -0,0 +1,45 @@
+#include "rb_persist.h"
+
+/**
+ * rbp_is_valid - checks if a version of a persistent tree is a valid
+ *                Red-Black Tree
+ *
+ * @root: root of the version
+ *
+ * Return: 1 if tree is valid, otherwise 0
+ */
+int rbp_is_valid(const rbp_node_t *root)
+{
+	if (root == NULL || root->color != BLACK)
+		return (0);
+	return (rbp_check(root, NULL, NULL) > 0);
+}
+
+/**
+ * rbp_check - checks order, colors and reference counts of a subtree
+ *
+ * @node: subtree root
+ * @min: every value must be greater than *@min, NULL for no lower bound
+ * @max: every value must be smaller than *@max, NULL for no upper bound
+ *
+ * Return: black height of the subtree, counting empty leaves, or 0 if the
+ *         subtree is invalid
+ */
+int rbp_check(const rbp_node_t *node, const int *min, const int *max)
+{
+	int hl, hr;
+
+	if (node == NULL)
+		return (1);
+	if ((min && node->n <= *min) || (max && node->n >= *max) ||
+	    __atomic_load_n(&node->ref, __ATOMIC_RELAXED) == 0 || node->fresh)
+		return (0);
+	if (node->color == RED && (!IS_BLACK(node->left) ||
+				   !IS_BLACK(node->right)))
+		return (0);
+	hl = rbp_check(node->left, min, &node->n);
+	hr = rbp_check(node->right, &node->n, max);
+	if (hl == 0 || hl != hr)
+		return (0);
+	return (hl + (node->color == BLACK));
+}
@@ -0,0 +1,96 @@
+#include "rb_rcu.h"
+
+/**
+ * rb_rcu_create - allocates an empty concurrent Red-Black tree, aligned on
+ *                 a cache line
+ *
+ * Return: pointer to the created tree, or NULL on failure
+ */
+rb_rcu_t *rb_rcu_create(void)
+{
+	rb_rcu_t *rcu = NULL;
+	void *mem = NULL;
+	int i;
+
+	if (posix_memalign(&mem, RB_RCU_CACHE_LINE, sizeof(rb_rcu_t)))
+		return (NULL);
+	rcu = mem;
+	if (pthread_mutex_init(&rcu->lock, NULL) != 0)
+	{
+		free(rcu);
+		return (NULL);
+	}
+	rcu->root = NULL;
+	rcu->epoch = 1;
+	rcu->retired = NULL;
+	for (i = 0; i < RB_RCU_MAX_READERS; i++)
+	{
+		rcu->readers[i].active = 0;
+		rcu->readers[i].in_use = 0;
+	}
+	return (rcu);
+}
+
+/**
+ * rb_rcu_destroy - frees a concurrent Red-Black tree
+ *
+ * No reader or writer may use the tree anymore.
+ *
+ * @rcu: pointer to the tree
+ */
+void rb_rcu_destroy(rb_rcu_t *rcu)
+{
+	rb_rcu_retired_t *retired;
+
+	if (rcu == NULL)
+		return;
+	while (rcu->retired)
+	{
+		retired = rcu->retired;
+		rcu->retired = retired->next;
+		rbp_release(retired->version);
+		free(retired);
+	}
+	rbp_release(rcu->root);
+	pthread_mutex_destroy(&rcu->lock);
+	free(rcu);
+}
+
+/**
+ * rb_rcu_register - reserves a reader slot for the calling thread
+ *
+ * @rcu: pointer to the tree
+ *
+ * Return: slot to pass to the read functions, or -1 if none is left
+ */
+int rb_rcu_register(rb_rcu_t *rcu)
+{
+	int i, expected;
+
+	if (rcu == NULL)
+		return (-1);
+	for (i = 0; i < RB_RCU_MAX_READERS; i++)
+	{
+		expected = 0;
+		if (__atomic_compare_exchange_n(&rcu->readers[i].in_use,
+						&expected, 1, 0,
+						__ATOMIC_ACQ_REL,
+						__ATOMIC_RELAXED))
+			return (i);
+	}
+	return (-1);
+}
+
+/**
+ * rb_rcu_unregister - gives a reader slot back
+ *
+ * @rcu: pointer to the tree
+ * @reader: slot returned by rb_rcu_register, outside any read section
+ */
+void rb_rcu_unregister(rb_rcu_t *rcu, int reader)
+{
+	if (rcu == NULL || reader < 0 || reader >= RB_RCU_MAX_READERS)
+		return;
+	__atomic_store_n(&rcu->readers[reader].active, 0, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&rcu->readers[reader].in_use, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,94 @@
+#include "rb_rcu.h"
+
+/**
+ * rb_rcu_read_lock - enters a read section and takes a snapshot
+ *
+ * The reader announces the current epoch before loading the root, so the
+ * writer keeps every version the reader may see until it leaves. Nothing
+ * is locked or written outside the reader's own slot.
+ *
+ * @rcu: pointer to the tree
+ * @reader: slot returned by rb_rcu_register
+ *
+ * Return: root of the published version, valid until rb_rcu_read_unlock
+ */
+const rbp_node_t *rb_rcu_read_lock(rb_rcu_t *rcu, int reader)
+{
+	unsigned long epoch;
+
+	epoch = __atomic_load_n(&rcu->epoch, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&rcu->readers[reader].active, epoch, __ATOMIC_SEQ_CST);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	return (__atomic_load_n(&rcu->root, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * rb_rcu_read_unlock - leaves a read section
+ *
+ * @rcu: pointer to the tree
+ * @reader: slot returned by rb_rcu_register
+ */
+void rb_rcu_read_unlock(rb_rcu_t *rcu, int reader)
+{
+	__atomic_store_n(&rcu->readers[reader].active, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * rb_rcu_find - checks if a value is in a concurrent Red-Black tree
+ *
+ * @rcu: pointer to the tree
+ * @reader: slot returned by rb_rcu_register
+ * @value: value to search for
+ *
+ * Return: 1 if @value is in the tree, 0 otherwise
+ */
+int rb_rcu_find(rb_rcu_t *rcu, int reader, int value)
+{
+	int found;
+
+	found = rbp_find(rb_rcu_read_lock(rcu, reader), value) != NULL;
+	rb_rcu_read_unlock(rcu, reader);
+	return (found);
+}
+
+/**
+ * rbp_range - calls a function on every node of a version whose value is
+ *             in [lo, hi]
+ *
+ * Versions have no parent pointers, so the in-order walk keeps the
+ * pending ancestors on a fixed stack of RBP_MAX_DEPTH nodes. The scan
+ * costs O(log(n) + k) and allocates nothing.
+ *
+ * @root: root of the version, e.g. from rb_rcu_read_lock
+ * @lo: smallest value to visit
+ * @hi: largest value to visit
+ * @action: function called for each node in range
+ * @data: passed as is to @action
+ *
+ * Return: number of nodes visited
+ */
+size_t rbp_range(const rbp_node_t *root, int lo, int hi,
+		 void (*action)(const rbp_node_t *node, void *data),
+		 void *data)
+{
+	const rbp_node_t *stack[RBP_MAX_DEPTH], *node = root;
+	size_t depth = 0, count = 0;
+
+	if (action == NULL)
+		return (0);
+	while (node || depth)
+	{
+		for (; node; node = node->n >= lo ? node->left : node->right)
+			if (node->n >= lo)
+				stack[depth++] = node;
+		if (depth == 0)
+			break;
+		node = stack[--depth];
+		if (node->n > hi)
+			break;
+		action(node, data);
+		count++;
+		node = node->right;
+	}
+	return (count);
+}
@@ -0,0 +1,139 @@
+#include <sched.h>
+#include "rb_rcu.h"
+
+/**
+ * rb_rcu_quiescent - checks that no reader can still hold a version
+ *                    replaced in a given epoch
+ *
+ * @rcu: pointer to the tree
+ * @epoch: epoch the version was replaced in
+ *
+ * Return: 1 if every reader is outside or entered after @epoch, else 0
+ */
+int rb_rcu_quiescent(rb_rcu_t *rcu, unsigned long epoch)
+{
+	unsigned long active;
+	int i;
+
+	for (i = 0; i < RB_RCU_MAX_READERS; i++)
+	{
+		active = __atomic_load_n(&rcu->readers[i].active,
+					 __ATOMIC_SEQ_CST);
+		if (active != 0 && active <= epoch)
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * rb_rcu_reclaim - releases the replaced versions no reader can hold
+ *
+ * @rcu: pointer to the tree, its lock held
+ */
+void rb_rcu_reclaim(rb_rcu_t *rcu)
+{
+	rb_rcu_retired_t **link = &rcu->retired, *retired;
+
+	while (*link)
+	{
+		retired = *link;
+		if (!rb_rcu_quiescent(rcu, retired->epoch))
+		{
+			link = &retired->next;
+			continue;
+		}
+		*link = retired->next;
+		rbp_release(retired->version);
+		free(retired);
+	}
+}
+
+/**
+ * rb_rcu_publish - makes a version visible to readers and retires the
+ *                  version it replaces
+ *
+ * The full fence orders the new root and epoch before the reader slots
+ * are scanned, matching the fence in rb_rcu_read_lock: either the scan
+ * sees a reader's slot, or that reader loads the new root.
+ *
+ * If the retired version cannot be queued, the writer waits for the
+ * readers of the current epoch to leave and releases it right away.
+ *
+ * @rcu: pointer to the tree, its lock held
+ * @version: root of the new version, owned by the tree from now on
+ */
+void rb_rcu_publish(rb_rcu_t *rcu, rbp_node_t *version)
+{
+	rb_rcu_retired_t *retired = malloc(sizeof(rb_rcu_retired_t));
+	rbp_node_t *old = rcu->root;
+	unsigned long epoch = rcu->epoch;
+
+	__atomic_store_n(&rcu->root, version, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&rcu->epoch, epoch + 1, __ATOMIC_SEQ_CST);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (retired == NULL)
+	{
+		while (!rb_rcu_quiescent(rcu, epoch))
+			sched_yield();
+		rbp_release(old);
+	}
+	else
+	{
+		retired->version = old;
+		retired->epoch = epoch;
+		retired->next = rcu->retired;
+		rcu->retired = retired;
+	}
+	rb_rcu_reclaim(rcu);
+}
+
+/**
+ * rb_rcu_insert - inserts a value in a concurrent Red-Black tree
+ *
+ * @rcu: pointer to the tree
+ * @value: the value to insert
+ *
+ * Return: 1 if @value was inserted, 0 if it was already present, -1 on
+ *         failure
+ */
+int rb_rcu_insert(rb_rcu_t *rcu, int value)
+{
+	rbp_node_t *version;
+	int ret;
+
+	if (rcu == NULL)
+		return (-1);
+	pthread_mutex_lock(&rcu->lock);
+	ret = rbp_insert(rcu->root, value, &version);
+	if (ret == 1)
+		rb_rcu_publish(rcu, version);
+	else if (ret == 0)
+		rbp_release(version);
+	pthread_mutex_unlock(&rcu->lock);
+	return (ret);
+}
+
+/**
+ * rb_rcu_remove - removes a value from a concurrent Red-Black tree
+ *
+ * @rcu: pointer to the tree
+ * @value: the value to remove
+ *
+ * Return: 1 if @value was removed, 0 if it was absent, -1 on failure
+ */
+int rb_rcu_remove(rb_rcu_t *rcu, int value)
+{
+	rbp_node_t *version;
+	int ret;
+
+	if (rcu == NULL)
+		return (-1);
+	pthread_mutex_lock(&rcu->lock);
+	ret = rbp_remove(rcu->root, value, &version);
+	if (ret == 1)
+		rb_rcu_publish(rcu, version);
+	else if (ret == 0)
+		rbp_release(version);
+	pthread_mutex_unlock(&rcu->lock);
+	return (ret);
+}
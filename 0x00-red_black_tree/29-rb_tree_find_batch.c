@@ -0,0 +1,59 @@
+#include "rb_trees.h"
+
+/**
+ * rb_tree_find_batch - looks many values up in a Red-Black Tree at once
+ *
+ * Up to RB_FIND_GROUP searches are in flight. Each round moves every one of
+ * them down a single level and prefetches the node it lands on, so the
+ * cache misses of different searches overlap instead of being paid one
+ * after the other. A finished search hands its slot to the next key.
+ *
+ * @tree: pointer to root node of the tree
+ * @keys: values to search for
+ * @n: number of values
+ * @out: receives, for each value, the node holding it or NULL
+ *
+ * Return: number of values found
+ */
+size_t rb_tree_find_batch(const rb_tree_t *tree, const int *keys, size_t n,
+			  const rb_tree_t **out)
+{
+	const rb_tree_t *node[RB_FIND_GROUP];
+	size_t slot[RB_FIND_GROUP], next = 0, found = 0;
+	int i, active = 0, key;
+
+	if (keys == NULL || out == NULL)
+		return (0);
+	for (; active < RB_FIND_GROUP && next < n; active++)
+	{
+		node[active] = tree;
+		slot[active] = next++;
+	}
+	while (active)
+	{
+		for (i = 0; i < active; i++)
+		{
+			key = keys[slot[i]];
+			if (node[i] && node[i]->n != key)
+			{
+				node[i] = key < node[i]->n ? node[i]->left
+							   : node[i]->right;
+				__builtin_prefetch(node[i]);
+				continue;
+			}
+			out[slot[i]] = node[i];
+			found += node[i] != NULL;
+			if (next < n)
+			{
+				node[i] = tree;
+				slot[i] = next++;
+				continue;
+			}
+			active--;
+			node[i] = node[active];
+			slot[i] = slot[active];
+			i--;
+		}
+	}
+	return (found);
+}
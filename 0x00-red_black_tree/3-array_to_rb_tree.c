@@ -3,6 +3,9 @@
 /**
  * array_to_rb_tree - builds a Binary Search Tree from an array
  *
+ * Sorted input is detected and linked bottom-up in O(n), without any
+ * comparison or rotation. Other input is inserted value by value.
+ *
  * @array: pointer to the first element of array to be converted
  * @size: number of elements in the array
  *
@@ -10,12 +13,16 @@
  */
 rb_tree_t *array_to_rb_tree(int *array, size_t size)
 {
-	size_t i;
+	size_t i, count;
 	rb_tree_t *new_RB_tree = NULL;
 
 	if (array == NULL)
 		return (NULL);
 
+	count = sorted_unique_count(array, size);
+	if (count)
+		return (rb_build_tree(array, size, count, NULL));
+
 	for (i = 0; i < size; i++)
 		rb_tree_insert(&new_RB_tree, array[i]);
 
@@ -0,0 +1,142 @@
+#include "rb_itree.h"
+
+/**
+ * rb_itree_recompute - recomputes the largest upper bound of a subtree
+ *                      from its root and children
+ *
+ * @node: subtree root, or NULL
+ */
+void rb_itree_recompute(rb_tree_t *node)
+{
+	int max;
+
+	if (node == NULL)
+		return;
+	max = RB_ITREE(node)->hi;
+	if (RB_ITREE_MAX(node->left) > max)
+		max = RB_ITREE_MAX(node->left);
+	if (RB_ITREE_MAX(node->right) > max)
+		max = RB_ITREE_MAX(node->right);
+	RB_ITREE(node)->max = max;
+}
+
+/**
+ * rb_itree_update - restores the largest upper bounds after an insertion
+ *                   or a removal
+ *
+ * The insert and delete fixups only rotate nodes that end up on the path
+ * from @node to the root or right below it, and the subtrees they move
+ * keep their contents. Recomputing both children of every node on that
+ * path before the node itself is therefore enough, in O(log(n)).
+ *
+ * @node: deepest node whose subtree changed
+ */
+void rb_itree_update(rb_tree_t *node)
+{
+	for (; node; node = node->parent)
+	{
+		rb_itree_recompute(node->left);
+		rb_itree_recompute(node->right);
+		rb_itree_recompute(node);
+	}
+}
+
+/**
+ * rb_itree_insert - inserts an interval in an interval Red-Black tree
+ *
+ * @tree: double pointer to root node of the tree
+ * @lo: lower bound of the interval
+ * @hi: upper bound of the interval, not smaller than @lo
+ * @value: value stored with the interval
+ *
+ * Return: pointer to the created node, or NULL on failure
+ */
+rb_itree_t *rb_itree_insert(rb_tree_t **tree, int lo, int hi, void *value)
+{
+	rb_tree_t **link = tree, *parent = NULL;
+	rb_itree_t *new = NULL;
+
+	if (tree == NULL || hi < lo)
+		return (NULL);
+	while (*link)
+	{
+		parent = *link;
+		if (lo < parent->n ||
+		    (lo == parent->n && hi < RB_ITREE(parent)->hi))
+			link = &parent->left;
+		else
+			link = &parent->right;
+	}
+
+	new = malloc(sizeof(rb_itree_t));
+	if (new == NULL)
+		return (NULL);
+	new->node.parent = parent;
+	new->node.n = lo;
+	new->node.color = RED;
+	new->node.left = NULL;
+	new->node.right = NULL;
+	new->node.size = 1;
+	new->hi = hi;
+	new->max = hi;
+	new->value = value;
+
+	*link = &new->node;
+	rb_tree_resize(parent, 1);
+	rb_insert_fixup(tree, &new->node);
+	rb_itree_update(&new->node);
+	return (new);
+}
+
+/**
+ * rb_itree_remove - removes an interval from an interval Red-Black tree
+ *
+ * @tree: double pointer to root node of the tree
+ * @interval: node to remove, as returned by rb_itree_insert or a query
+ *
+ * Return: the value that was stored with @interval
+ */
+void *rb_itree_remove(rb_tree_t **tree, rb_itree_t *interval)
+{
+	rb_tree_t *remove, *changed;
+	void *value;
+
+	if (tree == NULL || interval == NULL)
+		return (NULL);
+	remove = &interval->node;
+	changed = remove->parent;
+	if (remove->left && remove->right)
+	{
+		changed = tree_min(remove->right);
+		if (changed->parent != remove)
+			changed = changed->parent;
+	}
+	*tree = rb_tree_delete(*tree, remove);
+	rb_itree_update(changed);
+	value = interval->value;
+	free(interval);
+	return (value);
+}
+
+/**
+ * rb_itree_delete - frees an interval Red-Black tree
+ *
+ * The tree is flattened with rb_tree_vine first, so it is freed in O(n)
+ * time and O(1) space.
+ *
+ * @tree: pointer to root node of the tree
+ * @free_value: if not NULL, called on the value of every interval
+ */
+void rb_itree_delete(rb_tree_t *tree, void (*free_value)(void *value))
+{
+	rb_tree_t *next;
+	size_t count = 0;
+
+	for (tree = rb_tree_vine(tree, &count); tree; tree = next)
+	{
+		next = tree->right;
+		if (free_value)
+			free_value(RB_ITREE(tree)->value);
+		free(tree);
+	}
+}
@@ -0,0 +1,87 @@
+#include "rb_itree.h"
+
+/**
+ * rb_itree_find - looks an interval up in an interval Red-Black tree
+ *
+ * @tree: pointer to root node of the tree
+ * @lo: lower bound of the interval
+ * @hi: upper bound of the interval
+ *
+ * Return: pointer to the first node holding [@lo, @hi], or NULL if there
+ *         is none
+ */
+rb_itree_t *rb_itree_find(const rb_tree_t *tree, int lo, int hi)
+{
+	const rb_tree_t *found = NULL;
+
+	while (tree)
+	{
+		if (lo < tree->n || (lo == tree->n && hi <= RB_ITREE(tree)->hi))
+		{
+			if (lo == tree->n && hi == RB_ITREE(tree)->hi)
+				found = tree;
+			tree = tree->left;
+		}
+		else
+			tree = tree->right;
+	}
+	return ((rb_itree_t *)found);
+}
+
+/**
+ * rb_itree_overlap - calls a function on every interval overlapping
+ *                    [lo, hi], in order
+ *
+ * Subtrees whose largest upper bound is below @lo are skipped, and the
+ * walk stops at the first lower bound above @hi. Every node visited
+ * either overlaps [@lo, @hi] or lies on the path to one that does, so a
+ * query reporting k intervals costs O(log(n) + k) when the matches are
+ * clustered and O(min(n, k * log(n))) in the worst case.
+ *
+ * @tree: pointer to root node of the tree
+ * @lo: lower bound of the query
+ * @hi: upper bound of the query
+ * @action: function called for each overlapping interval
+ * @data: passed as is to @action
+ *
+ * Return: number of overlapping intervals
+ */
+size_t rb_itree_overlap(const rb_tree_t *tree, int lo, int hi,
+			void (*action)(const rb_itree_t *interval, void *data),
+			void *data)
+{
+	size_t count = 0;
+
+	while (tree && RB_ITREE(tree)->max >= lo)
+	{
+		count += rb_itree_overlap(tree->left, lo, hi, action, data);
+		if (tree->n > hi)
+			break;
+		if (RB_ITREE(tree)->hi >= lo)
+		{
+			if (action)
+				action(RB_ITREE(tree), data);
+			count++;
+		}
+		tree = tree->right;
+	}
+	return (count);
+}
+
+/**
+ * rb_itree_stab - calls a function on every interval containing a point,
+ *                 in order
+ *
+ * @tree: pointer to root node of the tree
+ * @x: point to search for
+ * @action: function called for each interval containing @x
+ * @data: passed as is to @action
+ *
+ * Return: number of intervals containing @x
+ */
+size_t rb_itree_stab(const rb_tree_t *tree, int x,
+		     void (*action)(const rb_itree_t *interval, void *data),
+		     void *data)
+{
+	return (rb_itree_overlap(tree, x, x, action, data));
+}
@@ -0,0 +1,64 @@
+#include "rb_itree.h"
+
+/**
+ * rb_itree_is_valid - checks if an interval tree is a valid Red-Black Tree
+ *                     with correct subtree sizes and upper bounds
+ *
+ * @tree: pointer to root node of the tree
+ *
+ * Return: 1 if tree is valid, otherwise 0
+ */
+int rb_itree_is_valid(const rb_tree_t *tree)
+{
+	if (tree == NULL || tree->color != BLACK || tree->parent != NULL)
+		return (0);
+	return (rb_itree_check(tree, NULL, NULL) > 0);
+}
+
+/**
+ * rb_itree_check - checks order, colors, links, sizes and upper bounds of
+ *                  an interval subtree
+ *
+ * @node: subtree root
+ * @min: every interval must not sort before @min, NULL for no bound
+ * @max: every interval must not sort after @max, NULL for no bound
+ *
+ * Return: black height of the subtree, counting empty leaves, or 0 if the
+ *         subtree is invalid
+ */
+int rb_itree_check(const rb_tree_t *node, const rb_tree_t *min,
+		   const rb_tree_t *max)
+{
+	int hl, hr, top;
+
+	if (node == NULL)
+		return (1);
+	if (RB_ITREE(node)->hi < node->n)
+		return (0);
+	if (min && (node->n < min->n || (node->n == min->n &&
+		    RB_ITREE(node)->hi < RB_ITREE(min)->hi)))
+		return (0);
+	if (max && (node->n > max->n || (node->n == max->n &&
+		    RB_ITREE(node)->hi > RB_ITREE(max)->hi)))
+		return (0);
+	if ((node->left && node->left->parent != node) ||
+	    (node->right && node->right->parent != node))
+		return (0);
+	if (node->color == RED && (!IS_BLACK(node->left) ||
+				   !IS_BLACK(node->right)))
+		return (0);
+	if (node->size != RB_SIZE(node->left) + RB_SIZE(node->right) + 1)
+		return (0);
+	top = RB_ITREE(node)->hi;
+	if (RB_ITREE_MAX(node->left) > top)
+		top = RB_ITREE_MAX(node->left);
+	if (RB_ITREE_MAX(node->right) > top)
+		top = RB_ITREE_MAX(node->right);
+	if (RB_ITREE(node)->max != top)
+		return (0);
+	hl = rb_itree_check(node->left, min, node);
+	hr = rb_itree_check(node->right, node, max);
+	if (hl == 0 || hl != hr)
+		return (0);
+	return (hl + (node->color == BLACK));
+}
@@ -0,0 +1,62 @@
+#include "rb_trees.h"
+
+#ifdef RB_STATS
+__thread rb_stats_t rb_stats;
+
+/**
+ * rb_stats_walk - records the depth of a node reached without a search,
+ *                 such as the successor found by tree_min
+ *
+ * @node: pointer to the node
+ */
+void rb_stats_walk(const rb_tree_t *node)
+{
+	size_t depth = 0;
+
+	for (; node; node = node->parent)
+		depth++;
+	if (depth > rb_stats.max_depth)
+		rb_stats.max_depth = depth;
+}
+#endif
+
+/**
+ * rb_stats_get - reads the counters of the calling thread
+ *
+ * Red-Black trees have no handle of their own, so counters are kept per
+ * thread: reset them, run the operations of one tree, then read them.
+ *
+ * @stats: receives the counters, all 0 when built without RB_STATS
+ *
+ * Return: 1 if counters are collected, 0 if built without RB_STATS
+ */
+int rb_stats_get(rb_stats_t *stats)
+{
+	if (stats == NULL)
+		return (0);
+#ifdef RB_STATS
+	*stats = rb_stats;
+	return (1);
+#else
+	stats->comparisons = 0;
+	stats->rotations = 0;
+	stats->recolors = 0;
+	stats->fixups = 0;
+	stats->max_depth = 0;
+	return (0);
+#endif
+}
+
+/**
+ * rb_stats_reset - sets the counters of the calling thread back to 0
+ */
+void rb_stats_reset(void)
+{
+#ifdef RB_STATS
+	rb_stats.comparisons = 0;
+	rb_stats.rotations = 0;
+	rb_stats.recolors = 0;
+	rb_stats.fixups = 0;
+	rb_stats.max_depth = 0;
+#endif
+}
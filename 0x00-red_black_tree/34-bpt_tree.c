@@ -0,0 +1,154 @@
+#include "rb_bptree.h"
+
+/**
+ * bpt_tree_create - allocates an empty B+tree
+ *
+ * Return: pointer to the created tree, or NULL on failure
+ */
+bpt_tree_t *bpt_tree_create(void)
+{
+	bpt_tree_t *tree = malloc(sizeof(bpt_tree_t));
+
+	if (tree == NULL)
+		return (NULL);
+	tree->root = NULL;
+	tree->height = 0;
+	tree->count = 0;
+	return (tree);
+}
+
+/**
+ * bpt_node_create - allocates an empty, cache-line aligned B+tree node
+ *
+ * @leaf: 1 for a leaf, 0 for an inner node
+ *
+ * Return: pointer to the created node, or NULL on failure
+ */
+bpt_node_t *bpt_node_create(int leaf)
+{
+	void *mem = NULL;
+	bpt_node_t *node;
+	int i;
+
+	if (posix_memalign(&mem, BPT_ALIGN,
+			   leaf ? sizeof(bpt_leaf_t) : sizeof(bpt_inner_t)))
+		return (NULL);
+	node = mem;
+	node->count = 0;
+	node->leaf = leaf;
+	for (i = 0; i < BPT_KEYS; i++)
+		node->keys[i] = INT_MAX;
+	if (leaf)
+		BPT_LEAF(node)->next = NULL;
+	return (node);
+}
+
+/**
+ * bpt_node_free - frees a B+tree node and all its descendants
+ *
+ * @node: pointer to the node
+ */
+void bpt_node_free(bpt_node_t *node)
+{
+	int i;
+
+	if (node == NULL)
+		return;
+	if (!node->leaf)
+		for (i = 0; i <= node->count; i++)
+			bpt_node_free(BPT_INNER(node)->child[i]);
+	free(node);
+}
+
+/**
+ * bpt_tree_delete - frees a B+tree
+ *
+ * @tree: pointer to the tree
+ */
+void bpt_tree_delete(bpt_tree_t *tree)
+{
+	if (tree == NULL)
+		return;
+	bpt_node_free(tree->root);
+	free(tree);
+}
+
+/**
+ * bpt_search - counts the keys of a node smaller than a value
+ *
+ * The loop always runs over BPT_KEYS slots and has no branch, so it
+ * vectorizes; the INT_MAX padding never counts.
+ *
+ * @node: pointer to the node
+ * @value: value to search for
+ *
+ * Return: index of the first key >= @value, which is also the child to
+ *         descend into in an inner node
+ */
+int bpt_search(const bpt_node_t *node, int value)
+{
+	int i, pos = 0;
+
+	for (i = 0; i < BPT_KEYS; i++)
+		pos += node->keys[i] < value;
+	return (pos);
+}
+
+/**
+ * bpt_tree_find - checks if a value is in a B+tree
+ *
+ * @tree: pointer to the tree
+ * @value: value to search for
+ *
+ * Return: 1 if @value is in the tree, 0 otherwise
+ */
+int bpt_tree_find(const bpt_tree_t *tree, int value)
+{
+	const bpt_node_t *node;
+	int pos;
+
+	if (tree == NULL || tree->root == NULL)
+		return (0);
+	node = tree->root;
+	while (!node->leaf)
+		node = BPT_INNER(node)->child[bpt_search(node, value)];
+	pos = bpt_search(node, value);
+	return (pos < node->count && node->keys[pos] == value);
+}
+
+/**
+ * bpt_tree_range - calls a function on every value of a B+tree in [lo, hi],
+ *                  in order
+ *
+ * @tree: pointer to the tree
+ * @lo: smallest value to visit
+ * @hi: largest value to visit
+ * @action: function called for each value in range
+ * @data: passed as is to @action
+ *
+ * Return: number of values visited
+ */
+size_t bpt_tree_range(const bpt_tree_t *tree, int lo, int hi,
+		      void (*action)(int value, void *data), void *data)
+{
+	const bpt_node_t *node;
+	size_t count = 0;
+	int pos;
+
+	if (tree == NULL || tree->root == NULL || action == NULL)
+		return (0);
+	node = tree->root;
+	while (!node->leaf)
+		node = BPT_INNER(node)->child[bpt_search(node, lo)];
+	for (pos = bpt_search(node, lo); node; node = BPT_LEAF(node)->next)
+	{
+		for (; pos < node->count; pos++, count++)
+		{
+			if (node->keys[pos] > hi)
+				return (count);
+			action(node->keys[pos], data);
+		}
+		pos = 0;
+	}
+	return (count);
+}
@@ -0,0 +1,108 @@
+#include "rb_bptree.h"
+
+/**
+ * bpt_split_child - splits a full child of a B+tree node in two
+ *
+ * The split is complete or nothing happens, so a failed allocation never
+ * leaves the tree half modified.
+ *
+ * @node: pointer to the inner node, not full
+ * @i: index of the full child
+ *
+ * Return: 1 on success, -1 on failure
+ */
+int bpt_split_child(bpt_node_t *node, int i)
+{
+	bpt_node_t **kids = BPT_INNER(node)->child, *child = kids[i], *new;
+	int half = BPT_KEYS / 2, keep, sep, j;
+
+	new = bpt_node_create(child->leaf);
+	if (new == NULL)
+		return (-1);
+	keep = child->leaf ? half : half + 1;
+	sep = child->keys[half - 1 + !child->leaf];
+	new->count = BPT_KEYS - keep;
+	memcpy(new->keys, child->keys + keep, sizeof(int) * new->count);
+	if (child->leaf)
+	{
+		BPT_LEAF(new)->next = BPT_LEAF(child)->next;
+		BPT_LEAF(child)->next = new;
+	}
+	else
+		memcpy(BPT_INNER(new)->child, BPT_INNER(child)->child + keep,
+		       sizeof(*kids) * (new->count + 1));
+	child->count = child->leaf ? keep : keep - 1;
+	for (j = child->count; j < BPT_KEYS; j++)
+		child->keys[j] = INT_MAX;
+
+	memmove(node->keys + i + 1, node->keys + i,
+		sizeof(int) * (node->count - i));
+	memmove(kids + i + 2, kids + i + 1, sizeof(*kids) * (node->count - i));
+	node->keys[i] = sep;
+	kids[i + 1] = new;
+	node->count++;
+	return (1);
+}
+
+/**
+ * bpt_tree_insert - inserts a value in a B+tree
+ *
+ * Full nodes are split on the way down, so the leaf reached always has
+ * room and no split has to travel back up.
+ *
+ * @tree: pointer to the tree
+ * @value: value to insert
+ *
+ * Return: 1 if @value was inserted, 0 if it was already present, -1 on
+ *         failure
+ */
+int bpt_tree_insert(bpt_tree_t *tree, int value)
+{
+	bpt_node_t *node, *root;
+	int pos;
+
+	if (tree == NULL)
+		return (-1);
+	if (tree->root == NULL)
+	{
+		tree->root = bpt_node_create(1);
+		if (tree->root == NULL)
+			return (-1);
+		tree->height = 1;
+	}
+	if (tree->root->count == BPT_KEYS)
+	{
+		root = bpt_node_create(0);
+		if (root == NULL)
+			return (-1);
+		BPT_INNER(root)->child[0] = tree->root;
+		if (bpt_split_child(root, 0) == -1)
+		{
+			free(root);
+			return (-1);
+		}
+		tree->root = root;
+		tree->height++;
+	}
+	node = tree->root;
+	while (!node->leaf)
+	{
+		pos = bpt_search(node, value);
+		if (BPT_INNER(node)->child[pos]->count == BPT_KEYS)
+		{
+			if (bpt_split_child(node, pos) == -1)
+				return (-1);
+			pos += value > node->keys[pos];
+		}
+		node = BPT_INNER(node)->child[pos];
+	}
+	pos = bpt_search(node, value);
+	if (pos < node->count && node->keys[pos] == value)
+		return (0);
+	memmove(node->keys + pos + 1, node->keys + pos,
+		sizeof(int) * (node->count - pos));
+	node->keys[pos] = value;
+	node->count++;
+	tree->count++;
+	return (1);
+}
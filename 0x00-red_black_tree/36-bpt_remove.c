@@ -0,0 +1,162 @@
+#include "rb_bptree.h"
+
+/**
+ * bpt_borrow_left - moves the last entry of a child's left sibling into
+ *                   the child
+ *
+ * @node: pointer to the parent inner node
+ * @i: index of the child, > 0
+ */
+void bpt_borrow_left(bpt_node_t *node, int i)
+{
+	bpt_node_t **kids = BPT_INNER(node)->child;
+	bpt_node_t *left = kids[i - 1], *child = kids[i];
+	bpt_node_t **lk = BPT_INNER(left)->child, **ck = BPT_INNER(child)->child;
+
+	memmove(child->keys + 1, child->keys, sizeof(int) * child->count);
+	if (child->leaf)
+		child->keys[0] = left->keys[left->count - 1];
+	else
+	{
+		memmove(ck + 1, ck, sizeof(*ck) * (child->count + 1));
+		child->keys[0] = node->keys[i - 1];
+		ck[0] = lk[left->count];
+	}
+	child->count++;
+	left->count--;
+	node->keys[i - 1] = left->keys[left->count - child->leaf];
+	left->keys[left->count] = INT_MAX;
+}
+
+/**
+ * bpt_borrow_right - moves the first entry of a child's right sibling into
+ *                    the child
+ *
+ * @node: pointer to the parent inner node
+ * @i: index of the child, < node->count
+ */
+void bpt_borrow_right(bpt_node_t *node, int i)
+{
+	bpt_node_t **kids = BPT_INNER(node)->child;
+	bpt_node_t *child = kids[i], *right = kids[i + 1];
+	bpt_node_t **ck = BPT_INNER(child)->child, **rk = BPT_INNER(right)->child;
+
+	if (child->leaf)
+	{
+		child->keys[child->count] = right->keys[0];
+		node->keys[i] = right->keys[0];
+	}
+	else
+	{
+		child->keys[child->count] = node->keys[i];
+		ck[child->count + 1] = rk[0];
+		node->keys[i] = right->keys[0];
+		memmove(rk, rk + 1, sizeof(*rk) * right->count);
+	}
+	child->count++;
+	right->count--;
+	memmove(right->keys, right->keys + 1, sizeof(int) * right->count);
+	right->keys[right->count] = INT_MAX;
+}
+
+/**
+ * bpt_merge - merges a child of a B+tree node with its right sibling
+ *
+ * @node: pointer to the parent inner node
+ * @i: index of the left child of the pair, < node->count
+ */
+void bpt_merge(bpt_node_t *node, int i)
+{
+	bpt_node_t **kids = BPT_INNER(node)->child;
+	bpt_node_t *left = kids[i], *right = kids[i + 1];
+
+	if (left->leaf)
+		BPT_LEAF(left)->next = BPT_LEAF(right)->next;
+	else
+	{
+		left->keys[left->count++] = node->keys[i];
+		memcpy(BPT_INNER(left)->child + left->count,
+		       BPT_INNER(right)->child,
+		       sizeof(*kids) * (right->count + 1));
+	}
+	memcpy(left->keys + left->count, right->keys,
+	       sizeof(int) * right->count);
+	left->count += right->count;
+	free(right);
+
+	memmove(node->keys + i, node->keys + i + 1,
+		sizeof(int) * (node->count - i - 1));
+	memmove(kids + i + 1, kids + i + 2,
+		sizeof(*kids) * (node->count - i - 1));
+	node->count--;
+	node->keys[node->count] = INT_MAX;
+}
+
+/**
+ * bpt_remove_rec - removes a value from a B+tree subtree
+ *
+ * A child left with fewer than BPT_MIN keys borrows from a sibling that
+ * can spare one, or is merged with it.
+ *
+ * @node: subtree root
+ * @value: value to remove
+ *
+ * Return: 1 if @value was removed, 0 if it was absent
+ */
+int bpt_remove_rec(bpt_node_t *node, int value)
+{
+	int pos = bpt_search(node, value);
+	bpt_node_t **kids;
+
+	if (node->leaf)
+	{
+		if (pos >= node->count || node->keys[pos] != value)
+			return (0);
+		node->count--;
+		memmove(node->keys + pos, node->keys + pos + 1,
+			sizeof(int) * (node->count - pos));
+		node->keys[node->count] = INT_MAX;
+		return (1);
+	}
+	kids = BPT_INNER(node)->child;
+	if (!bpt_remove_rec(kids[pos], value))
+		return (0);
+	if (kids[pos]->count >= BPT_MIN)
+		return (1);
+	if (pos > 0 && kids[pos - 1]->count > BPT_MIN)
+		bpt_borrow_left(node, pos);
+	else if (pos < node->count && kids[pos + 1]->count > BPT_MIN)
+		bpt_borrow_right(node, pos);
+	else if (pos > 0)
+		bpt_merge(node, pos - 1);
+	else
+		bpt_merge(node, pos);
+	return (1);
+}
+
+/**
+ * bpt_tree_remove - removes a value from a B+tree
+ *
+ * @tree: pointer to the tree
+ * @value: value to remove
+ *
+ * Return: 1 if @value was removed, 0 if it was absent
+ */
+int bpt_tree_remove(bpt_tree_t *tree, int value)
+{
+	bpt_node_t *root;
+
+	if (tree == NULL || tree->root == NULL)
+		return (0);
+	if (!bpt_remove_rec(tree->root, value))
+		return (0);
+	tree->count--;
+	root = tree->root;
+	if (root->count == 0)
+	{
+		tree->root = root->leaf ? NULL : BPT_INNER(root)->child[0];
+		tree->height--;
+		free(root);
+	}
+	return (1);
+}
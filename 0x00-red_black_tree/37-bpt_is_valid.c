@@ -0,0 +1,71 @@
+#include "rb_bptree.h"
+
+/**
+ * bpt_tree_is_valid - checks if a B+tree is valid
+ *
+ * @tree: pointer to the tree
+ *
+ * Return: 1 if tree is valid, otherwise 0
+ */
+int bpt_tree_is_valid(const bpt_tree_t *tree)
+{
+	const bpt_node_t *leaf = NULL;
+	long count;
+
+	if (tree == NULL || tree->root == NULL || tree->height < 1)
+		return (0);
+	count = bpt_check(tree->root, 1, tree->height, NULL, NULL, &leaf);
+	return (count >= 0 && (size_t)count == tree->count &&
+		BPT_LEAF(leaf)->next == NULL);
+}
+
+/**
+ * bpt_check - checks order, fill, padding, depth and leaf links of a
+ *             B+tree subtree
+ *
+ * @node: subtree root
+ * @depth: level of @node, the root being at level 1
+ * @height: number of levels of the tree
+ * @min: every value must be greater than *@min, NULL for no lower bound
+ * @max: every value must not exceed *@max, NULL for no upper bound
+ * @leaf: last leaf visited, in order; its next link must be the next leaf
+ *
+ * Return: number of values in the subtree, or -1 if the subtree is invalid
+ */
+long bpt_check(const bpt_node_t *node, int depth, int height,
+	       const int *min, const int *max, const bpt_node_t **leaf)
+{
+	long count = 0, sub;
+	const int *lo = min;
+	int i;
+
+	if (node == NULL || node->count < (depth == 1 ? 1 : BPT_MIN) ||
+	    node->count > BPT_KEYS || node->leaf != (depth == height))
+		return (-1);
+	for (i = 0; i < BPT_KEYS; i++)
+		if ((i < node->count && ((lo && node->keys[i] <= *lo) ||
+					 (max && node->keys[i] > *max))) ||
+		    (i >= node->count && node->keys[i] != INT_MAX))
+			return (-1);
+		else if (i < node->count)
+			lo = &node->keys[i];
+	if (node->leaf)
+	{
+		if (*leaf && BPT_LEAF(*leaf)->next != node)
+			return (-1);
+		*leaf = node;
+		return (node->count);
+	}
+	for (i = 0, lo = min; i <= node->count; i++)
+	{
+		sub = bpt_check(BPT_INNER(node)->child[i], depth + 1, height,
+				lo, i < node->count ? &node->keys[i] : max,
+				leaf);
+		if (sub < 0)
+			return (-1);
+		count += sub;
+		if (i < node->count)
+			lo = &node->keys[i];
+	}
+	return (count);
+}
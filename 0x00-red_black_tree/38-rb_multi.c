@@ -0,0 +1,88 @@
+#include "rb_multi.h"
+
+/**
+ * rb_multi_insert - adds one occurrence of a value to a Red-Black multiset
+ *
+ * A value already present only has its count incremented; the tree is
+ * rebalanced only when a new node is linked.
+ *
+ * @tree: double pointer to root node of the multiset
+ * @value: the value to add
+ *
+ * Return: pointer to the node holding @value, or NULL on failure
+ */
+rb_multi_t *rb_multi_insert(rb_tree_t **tree, int value)
+{
+	rb_tree_t **slot, *parent, *node;
+	rb_multi_t *new = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	slot = rb_tree_slot(tree, value, &parent);
+	if (slot == NULL)
+	{
+		if (parent == NULL)
+			node = *tree;
+		else
+			node = value < parent->n ? parent->left : parent->right;
+		RB_MULTI(node)->count++;
+		return (RB_MULTI(node));
+	}
+
+	new = malloc(sizeof(rb_multi_t));
+	if (new == NULL)
+		return (NULL);
+	new->node.parent = parent;
+	new->node.n = value;
+	new->node.color = RED;
+	new->node.left = NULL;
+	new->node.right = NULL;
+	new->node.size = 1;
+	new->count = 1;
+
+	*slot = &new->node;
+	rb_tree_resize(parent, 1);
+	rb_insert_fixup(tree, &new->node);
+	return (new);
+}
+
+/**
+ * rb_multi_remove - removes one occurrence of a value from a Red-Black
+ *                   multiset
+ *
+ * The node is unlinked, and the tree rebalanced, only when its last
+ * occurrence goes.
+ *
+ * @root: pointer to root node of the multiset
+ * @value: the value to remove
+ *
+ * Return: pointer to new root of the multiset
+ */
+rb_tree_t *rb_multi_remove(rb_tree_t *root, int value)
+{
+	rb_tree_t *node = (rb_tree_t *)rb_tree_find(root, value);
+
+	if (node == NULL)
+		return (root);
+	if (--RB_MULTI(node)->count > 0)
+		return (root);
+	root = rb_tree_delete(root, node);
+	free(node);
+	return (root);
+}
+
+/**
+ * rb_multi_count - counts the occurrences of a value in a Red-Black
+ *                  multiset
+ *
+ * @tree: pointer to root node of the multiset
+ * @value: the value to count
+ *
+ * Return: number of occurrences of @value
+ */
+size_t rb_multi_count(const rb_tree_t *tree, int value)
+{
+	const rb_tree_t *node = rb_tree_find(tree, value);
+
+	return (node ? RB_MULTI(node)->count : 0);
+}
@@ -0,0 +1,136 @@
+#include "rb_lazy.h"
+
+/**
+ * rb_lazy_create - allocates an empty Red-Black tree with lazy deletion
+ *
+ * @threshold: fraction of tombstones that triggers a compaction, 0 to only
+ *             compact on request
+ *
+ * Return: pointer to the created tree, or NULL on failure
+ */
+rb_lazy_t *rb_lazy_create(double threshold)
+{
+	rb_lazy_t *tree = malloc(sizeof(rb_lazy_t));
+
+	if (tree == NULL)
+		return (NULL);
+	tree->root = NULL;
+	tree->live = 0;
+	tree->dead = 0;
+	tree->threshold = threshold;
+	return (tree);
+}
+
+/**
+ * rb_lazy_delete - frees a Red-Black tree with lazy deletion
+ *
+ * @tree: pointer to the tree
+ */
+void rb_lazy_delete(rb_lazy_t *tree)
+{
+	if (tree == NULL)
+		return;
+	rb_build_free(tree->root);
+	free(tree);
+}
+
+/**
+ * rb_lazy_insert - inserts a value in a Red-Black tree with lazy deletion
+ *
+ * A tombstone holding the value is brought back to life in place.
+ *
+ * @tree: pointer to the tree
+ * @value: the value to insert
+ *
+ * Return: pointer to the node holding @value, or NULL on failure or if
+ *         @value is already in the tree
+ */
+rb_lazy_node_t *rb_lazy_insert(rb_lazy_t *tree, int value)
+{
+	rb_tree_t **slot, *parent, *node;
+	rb_lazy_node_t *new = NULL;
+
+	if (tree == NULL)
+		return (NULL);
+	slot = rb_tree_slot(&tree->root, value, &parent);
+	if (slot == NULL)
+	{
+		if (parent == NULL)
+			node = tree->root;
+		else
+			node = value < parent->n ? parent->left : parent->right;
+		if (!RB_LAZY(node)->dead)
+			return (NULL);
+		RB_LAZY(node)->dead = 0;
+		tree->dead--;
+		tree->live++;
+		return (RB_LAZY(node));
+	}
+
+	new = malloc(sizeof(rb_lazy_node_t));
+	if (new == NULL)
+		return (NULL);
+	new->node.parent = parent;
+	new->node.n = value;
+	new->node.color = RED;
+	new->node.left = NULL;
+	new->node.right = NULL;
+	new->node.size = 1;
+	new->dead = 0;
+
+	*slot = &new->node;
+	rb_tree_resize(parent, 1);
+	rb_insert_fixup(&tree->root, &new->node);
+	tree->live++;
+	return (new);
+}
+
+/**
+ * rb_lazy_remove - removes a value from a Red-Black tree with lazy deletion
+ *
+ * The node is only marked dead, in O(log(n)) and without restructuring.
+ * Once tombstones exceed the tree threshold, the tree is compacted.
+ *
+ * @tree: pointer to the tree
+ * @value: the value to remove
+ *
+ * Return: 1 if @value was removed, 0 if it was not in the tree
+ */
+int rb_lazy_remove(rb_lazy_t *tree, int value)
+{
+	rb_tree_t *node;
+
+	if (tree == NULL)
+		return (0);
+	node = (rb_tree_t *)rb_tree_find(tree->root, value);
+	if (node == NULL || RB_LAZY(node)->dead)
+		return (0);
+	RB_LAZY(node)->dead = 1;
+	tree->live--;
+	tree->dead++;
+	if (tree->threshold > 0 && (double)tree->dead >
+	    tree->threshold * (double)(tree->live + tree->dead))
+		rb_lazy_compact(tree);
+	return (1);
+}
+
+/**
+ * rb_lazy_find - looks a value up in a Red-Black tree with lazy deletion
+ *
+ * @tree: pointer to the tree
+ * @value: value to search for
+ *
+ * Return: pointer to the node holding @value, or NULL if it is not in the
+ *         tree or was removed
+ */
+const rb_tree_t *rb_lazy_find(const rb_lazy_t *tree, int value)
+{
+	const rb_tree_t *node;
+
+	if (tree == NULL)
+		return (NULL);
+	node = rb_tree_find(tree->root, value);
+	if (node == NULL || RB_LAZY(node)->dead)
+		return (NULL);
+	return (node);
+}
@@ -11,19 +11,28 @@
 rb_tree_t *rb_tree_remove(rb_tree_t *root, int n)
 {
 	rb_tree_t *remove = root;
+	size_t depth = 0;
 
-	while (remove && remove->n != n)
+	while (remove)
 	{
+		RB_STAT(comparisons, 1);
+		RB_STAT_DEPTH(depth);
+		if (remove->n == n)
+			break;
 		if (remove->n > n)
 			remove = remove->left;
 		else
 			remove = remove->right;
 	}
-	return (rb_tree_delete(root, remove));
+	if (remove == NULL)
+		return (root);
+	root = rb_tree_delete(root, remove);
+	free(remove);
+	return (root);
 }
 
 /**
- * rb_tree_delete - deltes node from RB Tree
+ * rb_tree_delete - unlinks a node from RB Tree without freeing it
  *
  * @root: pointer to root node of tree
  * @remove: node to remove
@@ -31,10 +40,12 @@ rb_tree_t *rb_tree_remove(rb_tree_t *root, int n)
  */
 rb_tree_t *rb_tree_delete(rb_tree_t *root, rb_tree_t *remove)
 {
-	rb_tree_t *x = NULL;
+	rb_tree_t *x = NULL, *x_parent = remove->parent;
 	rb_tree_t *y = remove;
 	rb_color_t og_color = remove->color;
 
+	if (remove->left == NULL || remove->right == NULL)
+		rb_tree_resize(remove->parent, -1);
 	if (remove->left == NULL)
 	{
 		x = remove->right;
@@ -48,13 +59,14 @@ rb_tree_t *rb_tree_delete(rb_tree_t *root, rb_tree_t *remove)
 	else
 	{
 		y = tree_min(remove->right);
-		if (y->color)
-			og_color = y->color;
+		RB_STAT_WALK(y);
+		og_color = y->color;
 		x = y->right;
-		if (y->parent && y->parent == remove)
-			x->parent = y;
-		else
+		x_parent = y;
+		rb_tree_resize(y->parent, -1);
+		if (y->parent != remove)
 		{
+			x_parent = y->parent;
 			rb_transplant(&root, y, y->right);
 			y->right = remove->right;
 			y->right->parent = y;
@@ -63,9 +75,10 @@ rb_tree_t *rb_tree_delete(rb_tree_t *root, rb_tree_t *remove)
 		y->left = remove->left;
 		y->left->parent = y;
 		y->color = remove->color;
+		y->size = remove->size;
 	}
 	if (og_color == BLACK)
-		rb_delete_fixup(root, x);
+		root = rb_delete_fixup(root, x, x_parent);
 	return (root);
 }
 /**
@@ -93,21 +106,25 @@ void rb_transplant(rb_tree_t **root, rb_tree_t *x, rb_tree_t *y)
  * rb_delete_fixup - restores red-black properties to search tree
  *
  * @root: pointer to root node of tree
- * @x: node to fix
+ * @x: node to fix, NULL when it is an empty leaf
+ * @parent: parent of @x
  *
  * Return: new pointer to root
  */
-rb_tree_t *rb_delete_fixup(rb_tree_t *root, rb_tree_t *x)
+rb_tree_t *rb_delete_fixup(rb_tree_t *root, rb_tree_t *x, rb_tree_t *parent)
 {
-	while (x != NULL && x->color == BLACK)
+	while (x != root && IS_BLACK(x))
 	{
-		if (x == x->parent->left)
-			x = rb_delete_fix_right(&root, x);
+		RB_STAT(fixups, 1);
+		if (x == parent->left)
+			x = rb_delete_fix_right(&root, &parent);
 		else
-			x = rb_delete_fix_left(&root, x);
+			x = rb_delete_fix_left(&root, &parent);
 	}
 	if (x)
-		x->color = BLACK;
+	{
+		RB_RECOLOR(x, BLACK);
+	}
 	return (root);
 }
 
@@ -115,90 +132,92 @@ rb_tree_t *rb_delete_fixup(rb_tree_t *root, rb_tree_t *x)
  * rb_delete_fix_left - fixes left sibling
  *
  * @root: pointer to root of tree
- * @x: node to fix
+ * @parent: pointer to parent of the node to fix, updated to the parent of
+ *          the next node to fix
  *
- * Return: pointer to updated node
+ * Return: pointer to the next node to fix
  */
-rb_tree_t *rb_delete_fix_left(rb_tree_t **root, rb_tree_t *x)
+rb_tree_t *rb_delete_fix_left(rb_tree_t **root, rb_tree_t **parent)
 {
-	rb_tree_t *y;
+	rb_tree_t *p = *parent, *y = p->left;
 
-	y = x->parent->left;
 	/* CASE 1 */
-	if (y && y->color == RED)
+	if (y->color == RED)
 	{
-		y->color = BLACK;
-		x->parent->color = RED;
-		rb_rotate_right(root, x->parent);
-		y = x->parent->left;
+		RB_RECOLOR(y, BLACK);
+		RB_RECOLOR(p, RED);
+		rb_rotate_right(root, p);
+		y = p->left;
 	}
 	/* CASE 2 */
-	if (y && y->right->color == BLACK && y->left->color == BLACK)
+	if (IS_BLACK(y->right) && IS_BLACK(y->left))
 	{
-		y->color = RED;
-		x = x->parent;
+		RB_RECOLOR(y, RED);
+		*parent = p->parent;
+		return (p);
 	}
 	/* CASE 3 */
-	else if (y && y->left->color == BLACK)
+	if (IS_BLACK(y->left))
 	{
-		y->right->color = BLACK;
-		y->color = RED;
+		RB_RECOLOR(y->right, BLACK);
+		RB_RECOLOR(y, RED);
 		rb_rotate_left(root, y);
-		y = x->parent->left;
+		y = p->left;
 	}
 	/* CASE 4 */
-	y->color = x->parent->color;
-	x->parent->color = BLACK;
-	y->right->color = BLACK;
-	rb_rotate_right(root, x->parent);
-	x = *root;
+	RB_RECOLOR(y, p->color);
+	RB_RECOLOR(p, BLACK);
+	RB_RECOLOR(y->left, BLACK);
+	rb_rotate_right(root, p);
+	*parent = NULL;
 
-	return (x);
+	return (*root);
 }
 
 /**
  * rb_delete_fix_right - fixes right sibling
  *
  * @root: pointer to root of tree
- * @x: node to fix
+ * @parent: pointer to parent of the node to fix, updated to the parent of
+ *          the next node to fix
  *
- * Return: pointer to new root
+ * Return: pointer to the next node to fix
  */
-rb_tree_t *rb_delete_fix_right(rb_tree_t **root, rb_tree_t *x)
+rb_tree_t *rb_delete_fix_right(rb_tree_t **root, rb_tree_t **parent)
 {
-	rb_tree_t *y = NULL;
+	rb_tree_t *p = *parent, *y = p->right;
 
-	y = x->parent->right;
-		/* CASE 1 */
-	if (y && y->color == RED)
+	/* CASE 1 */
+	if (y->color == RED)
 	{
-		y->color = BLACK;
-		x->parent->color = RED;
-		rb_rotate_left(root, x->parent);
-		y = x->parent->right;
+		RB_RECOLOR(y, BLACK);
+		RB_RECOLOR(p, RED);
+		rb_rotate_left(root, p);
+		y = p->right;
 	}
 	/* CASE 2 */
-	if (y && y->left->color == BLACK && y->right->color == BLACK)
+	if (IS_BLACK(y->left) && IS_BLACK(y->right))
 	{
-		y->color = RED;
-		x = x->parent;
+		RB_RECOLOR(y, RED);
+		*parent = p->parent;
+		return (p);
 	}
 	/* CASE 3 */
-	else if (y && y->right->color == BLACK)
+	if (IS_BLACK(y->right))
 	{
-		y->left->color = BLACK;
-		y->color = RED;
+		RB_RECOLOR(y->left, BLACK);
+		RB_RECOLOR(y, RED);
 		rb_rotate_right(root, y);
-		y = x->parent->right;
+		y = p->right;
 	}
 	/* CASE 4 */
-	y->color = x->parent->color;
-	x->parent->color = BLACK;
-	y->right->color = BLACK;
-	rb_rotate_left(root, x->parent);
-	x = *root;
+	RB_RECOLOR(y, p->color);
+	RB_RECOLOR(p, BLACK);
+	RB_RECOLOR(y->right, BLACK);
+	rb_rotate_left(root, p);
+	*parent = NULL;
 
-	return (x);
+	return (*root);
 }
 
 /**
@@ -0,0 +1,88 @@
+#include "rb_lazy.h"
+
+/**
+ * rb_lazy_first - finds the smallest live node of a Red-Black tree with
+ *                 lazy deletion
+ *
+ * @tree: pointer to the tree
+ *
+ * Return: pointer to the first live node, or NULL if there is none
+ */
+const rb_tree_t *rb_lazy_first(const rb_lazy_t *tree)
+{
+	const rb_tree_t *node;
+
+	if (tree == NULL)
+		return (NULL);
+	node = rb_tree_first(tree->root);
+	if (node && RB_LAZY(node)->dead)
+		node = rb_lazy_next(node);
+	return (node);
+}
+
+/**
+ * rb_lazy_next - finds the next live node in order, skipping tombstones
+ *
+ * @node: current node
+ *
+ * Return: pointer to the next live node, or NULL if there is none
+ */
+const rb_tree_t *rb_lazy_next(const rb_tree_t *node)
+{
+	do {
+		node = rb_tree_next(node);
+	} while (node && RB_LAZY(node)->dead);
+	return (node);
+}
+
+/**
+ * rb_lazy_prune - frees the tombstones of a sorted list
+ *
+ * @list: first node of the list, linked through the right pointers
+ *
+ * Return: pointer to the first live node of the list
+ */
+rb_tree_t *rb_lazy_prune(rb_tree_t *list)
+{
+	rb_tree_t **link = &list, *node;
+
+	while (*link)
+	{
+		node = *link;
+		if (RB_LAZY(node)->dead)
+		{
+			*link = node->right;
+			free(node);
+		}
+		else
+			link = &node->right;
+	}
+	return (list);
+}
+
+/**
+ * rb_lazy_compact - frees the tombstones of a Red-Black tree with lazy
+ *                   deletion and rebalances it
+ *
+ * The tree is flattened into a sorted list, the tombstones are unlinked
+ * from it, and the live nodes are relinked in place into a balanced tree,
+ * in linear time and O(1) space.
+ *
+ * @tree: pointer to the tree
+ *
+ * Return: 1 on success, -1 if @tree is NULL
+ */
+int rb_lazy_compact(rb_lazy_t *tree)
+{
+	rb_tree_t *list;
+	size_t count = 0;
+
+	if (tree == NULL)
+		return (-1);
+	if (tree->dead == 0)
+		return (1);
+	list = rb_lazy_prune(rb_tree_vine(tree->root, &count));
+	tree->root = rb_build_vine(list, tree->live);
+	tree->dead = 0;
+	return (1);
+}
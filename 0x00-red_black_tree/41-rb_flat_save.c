@@ -0,0 +1,73 @@
+#include <string.h>
+#include "rb_flat.h"
+
+/**
+ * rb_flat_fill - stores the values of a tree in Eytzinger order
+ *
+ * The implicit tree is walked in order while the Red-Black tree is
+ * iterated, so each key lands in place without a sorted copy.
+ *
+ * @keys: receives the keys
+ * @count: number of keys
+ * @i: index of the implicit subtree root
+ * @cur: next node of the Red-Black tree, in order
+ *
+ * Return: number of keys stored in the subtree
+ */
+size_t rb_flat_fill(int *keys, size_t count, size_t i, const rb_tree_t **cur)
+{
+	size_t stored;
+
+	if (i >= count)
+		return (0);
+	stored = rb_flat_fill(keys, count, 2 * i + 1, cur);
+	keys[i] = (*cur)->n;
+	*cur = rb_tree_next(*cur);
+	return (stored + 1 + rb_flat_fill(keys, count, 2 * i + 2, cur));
+}
+
+/**
+ * rb_flat_save - writes a Red-Black tree to a flat file
+ *
+ * The file holds the values as a complete binary tree in breadth-first
+ * (Eytzinger) order: every level full but the last, which is filled from
+ * the left. Every full level is black and the last one red, which keeps
+ * the black heights equal, so the layout is itself a valid Red-Black tree.
+ *
+ * @tree: pointer to root node of the tree
+ * @path: path of the file to create or truncate
+ *
+ * Return: 1 on success, -1 on failure
+ */
+int rb_flat_save(const rb_tree_t *tree, const char *path)
+{
+	rb_flat_header_t header;
+	const rb_tree_t *cur = rb_tree_first(tree);
+	size_t count = RB_SIZE(tree), bytes = (count + 7) / 8, i;
+	unsigned char *colors = calloc(bytes ? bytes : 1, 1);
+	int *keys = malloc(sizeof(int) * (count ? count : 1)), ret = -1;
+	FILE *file = NULL;
+
+	if (path && keys && colors)
+		file = fopen(path, "wb");
+	if (file)
+	{
+		for (i = ((size_t)1 << rb_red_depth(count)) - 1; i < count; i++)
+			colors[i >> 3] |= 1 << (i & 7);
+		rb_flat_fill(keys, count, 0, &cur);
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, RB_FLAT_MAGIC, sizeof(RB_FLAT_MAGIC));
+		header.order = RB_FLAT_ORDER;
+		header.version = RB_FLAT_VERSION;
+		header.count = count;
+		if (fwrite(&header, sizeof(header), 1, file) == 1 &&
+		    fwrite(keys, sizeof(int), count, file) == count &&
+		    fwrite(colors, 1, bytes, file) == bytes)
+			ret = 1;
+		if (fclose(file) != 0)
+			ret = -1;
+	}
+	free(keys);
+	free(colors);
+	return (ret);
+}
@@ -0,0 +1,136 @@
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "rb_flat.h"
+
+/**
+ * rb_flat_open - maps a flat Red-Black tree file for reading
+ *
+ * Nothing is copied or decoded: queries read the mapping directly.
+ *
+ * @path: path of the file
+ *
+ * Return: pointer to the mapped tree, or NULL on failure or if the file is
+ *         not a valid flat tree for this machine
+ */
+rb_flat_t *rb_flat_open(const char *path)
+{
+	const rb_flat_header_t *header;
+	rb_flat_t *flat = NULL;
+	struct stat st;
+	void *map;
+	int fd;
+
+	fd = path ? open(path, O_RDONLY) : -1;
+	if (fd == -1)
+		return (NULL);
+	if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(*header))
+	{
+		close(fd);
+		return (NULL);
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (NULL);
+	header = map;
+	if (memcmp(header->magic, RB_FLAT_MAGIC, sizeof(RB_FLAT_MAGIC)) ||
+	    header->order != RB_FLAT_ORDER ||
+	    header->version != RB_FLAT_VERSION ||
+	    header->count > ((size_t)st.st_size - sizeof(*header)) / sizeof(int) ||
+	    (size_t)st.st_size != sizeof(*header) + header->count * sizeof(int) +
+	    (header->count + 7) / 8 || (flat = malloc(sizeof(*flat))) == NULL)
+	{
+		munmap(map, st.st_size);
+		return (NULL);
+	}
+	flat->map = map;
+	flat->length = st.st_size;
+	flat->count = header->count;
+	flat->keys = (const int *)(header + 1);
+	flat->colors = (const unsigned char *)(flat->keys + flat->count);
+	return (flat);
+}
+
+/**
+ * rb_flat_close - unmaps a flat Red-Black tree
+ *
+ * @flat: pointer to the mapped tree
+ */
+void rb_flat_close(rb_flat_t *flat)
+{
+	if (flat == NULL)
+		return;
+	munmap(flat->map, flat->length);
+	free(flat);
+}
+
+/**
+ * rb_flat_find - checks if a value is in a flat Red-Black tree
+ *
+ * @flat: pointer to the mapped tree
+ * @value: value to search for
+ *
+ * Return: 1 if @value is in the tree, 0 otherwise
+ */
+int rb_flat_find(const rb_flat_t *flat, int value)
+{
+	size_t i = 0;
+
+	if (flat == NULL)
+		return (0);
+	while (i < flat->count && flat->keys[i] != value)
+		i = 2 * i + 1 + (flat->keys[i] < value);
+	return (i < flat->count);
+}
+
+/**
+ * rb_flat_lower_bound - finds the first key not smaller than a value
+ *
+ * The descent has no data-dependent branch; the answer is the last node
+ * where the search went left, recovered from the final index.
+ *
+ * @flat: pointer to the mapped tree
+ * @value: value to search for
+ *
+ * Return: index of the smallest key >= @value, or flat->count if there is
+ *         none
+ */
+size_t rb_flat_lower_bound(const rb_flat_t *flat, int value)
+{
+	size_t i = 1;
+
+	if (flat == NULL)
+		return (0);
+	while (i <= flat->count)
+		i = 2 * i + (flat->keys[i - 1] < value);
+	while (i & 1)
+		i >>= 1;
+	i >>= 1;
+	return (i ? i - 1 : flat->count);
+}
+
+/**
+ * rb_flat_next - finds the index of the next key in order
+ *
+ * @flat: pointer to the mapped tree
+ * @i: index of the current key
+ *
+ * Return: index of the next key, or flat->count if @i is the last one
+ */
+size_t rb_flat_next(const rb_flat_t *flat, size_t i)
+{
+	if (flat == NULL || i >= flat->count)
+		return (flat ? flat->count : 0);
+	if (2 * i + 2 < flat->count)
+	{
+		for (i = 2 * i + 2; 2 * i + 1 < flat->count; i = 2 * i + 1)
+			;
+		return (i);
+	}
+	while (i > 0 && i % 2 == 0)
+		i = (i - 1) / 2;
+	return (i > 0 ? (i - 1) / 2 : flat->count);
+}
@@ -0,0 +1,58 @@
+#include "rb_flat.h"
+
+/**
+ * rb_flat_node - copies a subtree of a flat Red-Black tree into nodes
+ *
+ * @flat: pointer to the mapped tree
+ * @i: index of the subtree root
+ * @parent: parent of the subtree
+ * @failed: set when a node allocation fails
+ *
+ * Return: pointer to the subtree root, or NULL if it is empty or on failure
+ */
+rb_tree_t *rb_flat_node(const rb_flat_t *flat, size_t i, rb_tree_t *parent,
+			int *failed)
+{
+	rb_tree_t *node;
+
+	if (i >= flat->count || *failed)
+		return (NULL);
+	node = rb_tree_node(parent, flat->keys[i],
+			    RB_FLAT_RED(flat, i) ? RED : BLACK);
+	if (node == NULL)
+	{
+		*failed = 1;
+		return (NULL);
+	}
+	node->left = rb_flat_node(flat, 2 * i + 1, node, failed);
+	node->right = rb_flat_node(flat, 2 * i + 2, node, failed);
+	node->size = RB_SIZE(node->left) + RB_SIZE(node->right) + 1;
+	return (node);
+}
+
+/**
+ * rb_flat_to_rb_tree - turns a flat Red-Black tree back into a mutable one
+ *
+ * The stored shape and colors are already balanced, so the nodes are
+ * linked in linear time without a comparison or a rotation.
+ *
+ * @flat: pointer to the mapped tree
+ *
+ * Return: pointer to root node of the created tree, or NULL on failure or
+ *         if @flat is empty
+ */
+rb_tree_t *rb_flat_to_rb_tree(const rb_flat_t *flat)
+{
+	rb_tree_t *root;
+	int failed = 0;
+
+	if (flat == NULL)
+		return (NULL);
+	root = rb_flat_node(flat, 0, NULL, &failed);
+	if (failed)
+	{
+		rb_build_free(root);
+		return (NULL);
+	}
+	return (root);
+}
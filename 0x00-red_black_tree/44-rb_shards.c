@@ -0,0 +1,184 @@
+#include <limits.h>
+#include "rb_shard.h"
+
+/**
+ * rb_shards_create - allocates an empty sharded Red-Black tree
+ *
+ * The boundaries start evenly spread over [@lo, @hi], the expected range of
+ * the values; rebalancing moves them once the values are known.
+ *
+ * @count: number of shards
+ * @lo: smallest expected value
+ * @hi: largest expected value
+ *
+ * Return: pointer to the created tree, or NULL on failure
+ */
+rb_shards_t *rb_shards_create(size_t count, int lo, int hi)
+{
+	rb_shards_t *tree = NULL;
+	void *mem = NULL;
+	size_t i;
+
+	if (count == 0 || lo > hi)
+		return (NULL);
+	tree = malloc(sizeof(rb_shards_t));
+	if (tree == NULL)
+		return (NULL);
+	if (posix_memalign(&mem, RB_SHARD_CACHE_LINE,
+			   sizeof(rb_shard_t) * count))
+		mem = NULL;
+	tree->shards = mem;
+	tree->lower = malloc(sizeof(int) * count);
+	if (tree->shards == NULL || tree->lower == NULL)
+	{
+		free(tree->shards);
+		free(tree->lower);
+		free(tree);
+		return (NULL);
+	}
+	tree->count = count;
+	tree->limit = RB_SHARD_SLACK;
+	for (i = 0; i < count; i++)
+	{
+		pthread_mutex_init(&tree->shards[i].lock, NULL);
+		tree->shards[i].root = NULL;
+		tree->lower[i] = (int)(lo + ((int64_t)hi - lo + 1) *
+				       (int64_t)i / (int64_t)count);
+	}
+	tree->lower[0] = INT_MIN;
+	return (tree);
+}
+
+/**
+ * rb_shards_destroy - frees a sharded Red-Black tree
+ *
+ * No thread may use the tree anymore.
+ *
+ * @tree: pointer to the tree
+ */
+void rb_shards_destroy(rb_shards_t *tree)
+{
+	size_t i;
+
+	if (tree == NULL)
+		return;
+	for (i = 0; i < tree->count; i++)
+	{
+		rb_build_free(tree->shards[i].root);
+		pthread_mutex_destroy(&tree->shards[i].lock);
+	}
+	free(tree->shards);
+	free(tree->lower);
+	free(tree);
+}
+
+/**
+ * rb_shards_lock - locks the shard a value belongs to
+ *
+ * The boundaries are searched without a lock, so a rebalancing may move
+ * them before the shard is locked; the search is then retried.
+ *
+ * @tree: pointer to the tree
+ * @value: the value
+ *
+ * Return: index of the locked shard
+ */
+size_t rb_shards_lock(rb_shards_t *tree, int value)
+{
+	size_t lo, hi, mid;
+
+	while (1)
+	{
+		lo = 0;
+		hi = tree->count;
+		while (hi - lo > 1)
+		{
+			mid = lo + (hi - lo) / 2;
+			if (__atomic_load_n(&tree->lower[mid],
+					    __ATOMIC_RELAXED) <= value)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		pthread_mutex_lock(&tree->shards[lo].lock);
+		if (tree->lower[lo] <= value &&
+		    (lo + 1 == tree->count || value < tree->lower[lo + 1]))
+			return (lo);
+		pthread_mutex_unlock(&tree->shards[lo].lock);
+	}
+}
+
+/**
+ * rb_shards_insert - inserts a value in a sharded Red-Black tree
+ *
+ * A shard growing past the limit rebalances the boundaries afterwards,
+ * unless another insertion has already done so meanwhile.
+ *
+ * @tree: pointer to the tree
+ * @value: the value to insert
+ *
+ * Return: 1 if @value was inserted, 0 if it was already present, -1 on
+ *         failure
+ */
+int rb_shards_insert(rb_shards_t *tree, int value)
+{
+	rb_shard_t *shard;
+	int ret = 0, over = 0;
+
+	if (tree == NULL)
+		return (-1);
+	shard = &tree->shards[rb_shards_lock(tree, value)];
+	if (rb_tree_find(shard->root, value) == NULL)
+	{
+		ret = rb_tree_insert(&shard->root, value) ? 1 : -1;
+		over = RB_SIZE(shard->root) > tree->limit;
+	}
+	pthread_mutex_unlock(&shard->lock);
+	if (over)
+		rb_shards_rebalance(tree, 0);
+	return (ret);
+}
+
+/**
+ * rb_shards_remove - removes a value from a sharded Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @value: the value to remove
+ *
+ * Return: 1 if @value was removed, 0 if it was absent, -1 on failure
+ */
+int rb_shards_remove(rb_shards_t *tree, int value)
+{
+	rb_shard_t *shard;
+	size_t size;
+
+	if (tree == NULL)
+		return (-1);
+	shard = &tree->shards[rb_shards_lock(tree, value)];
+	size = RB_SIZE(shard->root);
+	shard->root = rb_tree_remove(shard->root, value);
+	size -= RB_SIZE(shard->root);
+	pthread_mutex_unlock(&shard->lock);
+	return (size ? 1 : 0);
+}
+
+/**
+ * rb_shards_find - checks if a value is in a sharded Red-Black tree
+ *
+ * @tree: pointer to the tree
+ * @value: the value to search for
+ *
+ * Return: 1 if @value is in the tree, 0 otherwise
+ */
+int rb_shards_find(rb_shards_t *tree, int value)
+{
+	rb_shard_t *shard;
+	int found;
+
+	if (tree == NULL)
+		return (0);
+	shard = &tree->shards[rb_shards_lock(tree, value)];
+	found = rb_tree_find(shard->root, value) != NULL;
+	pthread_mutex_unlock(&shard->lock);
+	return (found);
+}
@@ -0,0 +1,67 @@
+#include "rb_shard.h"
+
+/**
+ * rb_shards_bound - moves the lower boundary of a shard
+ *
+ * Every shard lock must be held; lock-free searches may read the boundary
+ * concurrently.
+ *
+ * @tree: pointer to the tree
+ * @i: index of the shard
+ * @lower: smallest value of the shard
+ */
+void rb_shards_bound(rb_shards_t *tree, size_t i, int lower)
+{
+	__atomic_store_n(&tree->lower[i], lower, __ATOMIC_RELAXED);
+}
+
+/**
+ * rb_shards_rebalance - evens out the shards of a sharded Red-Black tree
+ *
+ * Every shard is locked, in order, and the shards are joined into one tree
+ * then split back by rank, so shard i gets the values ranked from
+ * i * total / count. Joins and splits relink nodes in O(log(n)) each: the
+ * whole pass costs O(count * log(n)) and neither copies nor allocates.
+ *
+ * @tree: pointer to the tree
+ * @force: rebalance anyway when set; otherwise only if a shard still holds
+ *         more than the limit once every shard is locked
+ *
+ * Return: 1 if the shards were rebalanced, 0 otherwise
+ */
+int rb_shards_rebalance(rb_shards_t *tree, int force)
+{
+	rb_tree_t *rest = NULL, *right, *node;
+	size_t i, total = 0, taken = 0, want, over = force;
+
+	if (tree == NULL)
+		return (0);
+	for (i = 0; i < tree->count; i++)
+		pthread_mutex_lock(&tree->shards[i].lock);
+	for (i = 0; i < tree->count; i++)
+	{
+		total += RB_SIZE(tree->shards[i].root);
+		over |= RB_SIZE(tree->shards[i].root) > tree->limit;
+	}
+	if (over && total > 0)
+	{
+		for (i = 0; i < tree->count; i++)
+			rest = rb_tree_join2(rest, tree->shards[i].root);
+		for (i = 1; i < tree->count; i++)
+		{
+			want = total * i / tree->count - taken;
+			node = (rb_tree_t *)rb_tree_select(rest, want);
+			rb_tree_split(rest, node->n, &tree->shards[i - 1].root,
+				      &right);
+			rest = rb_tree_join(NULL, node, right);
+			rb_shards_bound(tree, i, node->n);
+			taken += want;
+		}
+		tree->shards[tree->count - 1].root = rest;
+		tree->limit = total / tree->count * RB_SHARD_SKEW +
+			RB_SHARD_SLACK;
+	}
+	for (i = tree->count; i > 0; i--)
+		pthread_mutex_unlock(&tree->shards[i - 1].lock);
+	return (over && total > 0);
+}
@@ -0,0 +1,36 @@
+#include "rb_shard.h"
+
+/**
+ * rb_shards_range - visits the values of a sharded tree within a range
+ *
+ * The shards overlapping [@lo, @hi] are locked in order before any value
+ * is visited, so the walk sees one consistent state of the range. Holding
+ * the first one already keeps rebalancing, which needs every shard lock,
+ * from moving the boundaries. @action must not call back into @tree.
+ *
+ * @tree: pointer to the tree
+ * @lo: smallest value to visit
+ * @hi: largest value to visit
+ * @action: function called on each node, in increasing order
+ * @data: passed to @action
+ *
+ * Return: number of nodes visited
+ */
+size_t rb_shards_range(rb_shards_t *tree, int lo, int hi,
+		       void (*action)(const rb_tree_t *node, void *data),
+		       void *data)
+{
+	size_t first, last, i, visited = 0;
+
+	if (tree == NULL || lo > hi)
+		return (0);
+	first = rb_shards_lock(tree, lo);
+	for (last = first; last + 1 < tree->count &&
+	     tree->lower[last + 1] <= hi; last++)
+		pthread_mutex_lock(&tree->shards[last + 1].lock);
+	for (i = first; i <= last; i++)
+		visited += rb_tree_range(tree->shards[i].root, lo, hi, action, data);
+	for (i = last + 1; i > first; i--)
+		pthread_mutex_unlock(&tree->shards[i - 1].lock);
+	return (visited);
+}
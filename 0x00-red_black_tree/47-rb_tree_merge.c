@@ -0,0 +1,62 @@
+#include "rb_trees.h"
+
+/**
+ * rb_vine_merge - merges two sorted lists, freeing duplicates
+ *
+ * @a: first list, consumed
+ * @b: second list, consumed, nodes whose value is in @a are freed
+ * @count: decremented by the number of freed nodes
+ *
+ * Return: pointer to the first node of the merged list
+ */
+rb_tree_t *rb_vine_merge(rb_tree_t *a, rb_tree_t *b, size_t *count)
+{
+	rb_tree_t *list = NULL, **tail = &list, *dup;
+
+	while (a && b)
+	{
+		if (a->n == b->n)
+		{
+			dup = b;
+			b = b->right;
+			free(dup);
+			(*count)--;
+		}
+		else if (a->n < b->n)
+		{
+			*tail = a;
+			tail = &a->right;
+			a = a->right;
+		}
+		else
+		{
+			*tail = b;
+			tail = &b->right;
+			b = b->right;
+		}
+	}
+	*tail = a ? a : b;
+	return (list);
+}
+
+/**
+ * rb_tree_merge - merges two Red-Black trees in linear time
+ *
+ * Both trees are flattened in order, merged, and relinked into a balanced
+ * tree, in O(n + m) time without allocating. rb_tree_union is faster when
+ * one tree is much smaller than the other.
+ *
+ * @a: first tree, consumed
+ * @b: second tree, consumed, duplicates of @a are freed
+ *
+ * Return: pointer to root node of the merged tree
+ */
+rb_tree_t *rb_tree_merge(rb_tree_t *a, rb_tree_t *b)
+{
+	rb_tree_t *list;
+	size_t count = 0;
+
+	list = rb_tree_vine(a, &count);
+	list = rb_vine_merge(list, rb_tree_vine(b, &count), &count);
+	return (rb_build_vine(list, count));
+}
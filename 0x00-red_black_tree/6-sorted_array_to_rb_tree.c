@@ -0,0 +1,270 @@
+#include "rb_trees.h"
+
+/**
+ * sorted_unique_count - checks that an array is sorted in ascending order
+ *                       and counts its distinct values
+ *
+ * @array: pointer to the first element of the array
+ * @size: number of elements in the array
+ *
+ * Return: number of distinct values, or 0 if the array is empty or unsorted
+ */
+size_t sorted_unique_count(const int *array, size_t size)
+{
+	size_t i, count;
+
+	if (array == NULL || size == 0)
+		return (0);
+
+	for (i = 1, count = 1; i < size; i++)
+	{
+		if (array[i] < array[i - 1])
+			return (0);
+		if (array[i] != array[i - 1])
+			count++;
+	}
+	return (count);
+}
+
+/**
+ * rb_red_depth - computes the depth of the red level of a balanced tree
+ *
+ * @count: number of nodes in the tree
+ *
+ * Return: number of full levels, which is also the depth of the last,
+ *         partial level, whose nodes are red
+ */
+size_t rb_red_depth(size_t count)
+{
+	size_t full = 0;
+
+	while (((size_t)2 << full) - 1 <= count)
+		full++;
+	return (full);
+}
+
+/**
+ * rb_build_take - takes the node of a subtree root once its left subtree
+ *                 is built
+ *
+ * @b: build state
+ * @slot: index in @b->block reserved for the node, before its subtrees
+ *
+ * Return: pointer to the node, or NULL on failure
+ */
+rb_tree_t *rb_build_take(rb_build_t *b, size_t slot)
+{
+	rb_tree_t *node;
+
+	if (b->block)
+		node = &b->block[slot];
+	else if (b->list)
+	{
+		node = b->list;
+		b->list = node->right;
+		return (node);
+	}
+	else
+		node = rb_tree_node(NULL, 0, BLACK);
+	if (node == NULL)
+		return (NULL);
+	node->n = b->array[b->i++];
+	while (b->i < b->size && b->array[b->i] == node->n)
+		b->i++;
+	return (node);
+}
+
+/**
+ * rb_build_sorted - links the next @count values of a build into a balanced
+ *                   subtree
+ *
+ * Values and existing nodes are taken in order; nodes of @b->block are
+ * reserved in pre-order so the root is the first one. Every level above
+ * @b->red_depth is full and black, and the nodes of the last, partial level
+ * are red. The parent of the subtree root is left to the caller.
+ *
+ * On failure, the nodes already built stay linked below the returned root,
+ * so the caller can still free them all with rb_build_free.
+ *
+ * @b: build state
+ * @count: number of nodes in the subtree
+ * @depth: depth of the subtree root
+ *
+ * Return: pointer to the subtree root, or NULL if @count is 0
+ */
+rb_tree_t *rb_build_sorted(rb_build_t *b, size_t count, size_t depth)
+{
+	rb_tree_t *node, *left;
+	size_t slot = b->slot, half = (count - 1) / 2;
+
+	if (count == 0 || b->failed)
+		return (NULL);
+	if (b->block)
+		b->slot++;
+	left = rb_build_sorted(b, half, depth + 1);
+	if (b->failed)
+		return (left);
+	node = rb_build_take(b, slot);
+	if (node == NULL)
+	{
+		b->failed = 1;
+		return (left);
+	}
+	node->left = left;
+	node->right = rb_build_sorted(b, count - 1 - half, depth + 1);
+	if (node->left)
+		node->left->parent = node;
+	if (node->right)
+		node->right->parent = node;
+	node->parent = NULL;
+	node->color = depth == b->red_depth ? RED : BLACK;
+	node->size = count;
+	return (node);
+}
+
+/**
+ * rb_build_init - prepares the state of a build
+ *
+ * @b: build state to fill
+ * @count: number of nodes to build
+ */
+void rb_build_init(rb_build_t *b, size_t count)
+{
+	b->array = NULL;
+	b->size = 0;
+	b->i = 0;
+	b->list = NULL;
+	b->block = NULL;
+	b->slot = 0;
+	b->red_depth = rb_red_depth(count);
+	b->failed = 0;
+}
+
+/**
+ * rb_tree_vine - flattens a Red-Black tree into a sorted list
+ *
+ * Left children are rotated up until the node has none, so each node is
+ * appended in order, in O(n) time and O(1) space; the list is linked
+ * through the right pointers.
+ *
+ * @tree: pointer to root node of the tree, consumed
+ * @count: incremented by the number of nodes
+ *
+ * Return: pointer to the first node of the list
+ */
+rb_tree_t *rb_tree_vine(rb_tree_t *tree, size_t *count)
+{
+	rb_tree_t *list = NULL, **tail = &list, *left;
+
+	while (tree)
+	{
+		left = tree->left;
+		if (left)
+		{
+			tree->left = left->right;
+			left->right = tree;
+			tree = left;
+		}
+		else
+		{
+			*tail = tree;
+			tail = &tree->right;
+			tree = tree->right;
+			(*count)++;
+		}
+	}
+	return (list);
+}
+
+/**
+ * rb_build_free - frees a tree whose nodes were allocated one by one
+ *
+ * @tree: pointer to root node of the tree
+ */
+void rb_build_free(rb_tree_t *tree)
+{
+	rb_tree_t *next;
+	size_t count = 0;
+
+	for (tree = rb_tree_vine(tree, &count); tree; tree = next)
+	{
+		next = tree->right;
+		free(tree);
+	}
+}
+
+/**
+ * rb_build_tree - builds a Red-Black tree from a sorted array in linear time
+ *
+ * @array: pointer to the first element of the sorted array
+ * @size: number of elements in the array
+ * @count: number of distinct values in the array
+ * @block: storage for @count nodes, or NULL to allocate nodes one by one
+ *
+ * Return: pointer to root node of created RB Tree, or NULL on failure
+ */
+rb_tree_t *rb_build_tree(const int *array, size_t size, size_t count,
+			 rb_tree_t *block)
+{
+	rb_build_t b;
+	rb_tree_t *root;
+
+	rb_build_init(&b, count);
+	b.array = array;
+	b.size = size;
+	b.block = block;
+	root = rb_build_sorted(&b, count, 0);
+	if (b.failed)
+	{
+		rb_build_free(root);
+		return (NULL);
+	}
+	return (root);
+}
+
+/**
+ * rb_build_vine - rebuilds a balanced Red-Black tree from a sorted list
+ *                 in linear time, without allocating
+ *
+ * @list: first node of the list, linked through the right pointers
+ * @count: number of nodes in the list
+ *
+ * Return: pointer to root node of the rebuilt tree, NULL if @count is 0
+ */
+rb_tree_t *rb_build_vine(rb_tree_t *list, size_t count)
+{
+	rb_build_t b;
+
+	rb_build_init(&b, count);
+	b.list = list;
+	return (rb_build_sorted(&b, count, 0));
+}
+
+/**
+ * sorted_array_to_rb_tree - bulk loads a Red-Black tree from a sorted array
+ *
+ * Duplicates are skipped. All nodes live in a single allocation whose first
+ * node is the returned root, so the whole tree is released with one call to
+ * free(root). Such a tree must not be passed to rb_tree_insert or
+ * rb_tree_remove.
+ *
+ * @array: pointer to the first element of the array, sorted ascending
+ * @size: number of elements in the array
+ *
+ * Return: pointer to root node of created RB Tree, or NULL on failure or if
+ *         @array is not sorted
+ */
+rb_tree_t *sorted_array_to_rb_tree(int *array, size_t size)
+{
+	rb_tree_t *block;
+	size_t count = sorted_unique_count(array, size);
+
+	if (count == 0)
+		return (NULL);
+
+	block = malloc(sizeof(rb_tree_t) * count);
+	if (block == NULL)
+		return (NULL);
+
+	return (rb_build_tree(array, size, count, block));
+}
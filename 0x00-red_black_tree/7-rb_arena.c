@@ -0,0 +1,125 @@
+#include "rb_trees.h"
+
+/**
+ * rb_arena_create - creates a node pool for Red-Black trees
+ *
+ * @slab_size: number of nodes per slab, 0 for RB_ARENA_SLAB
+ *
+ * Return: pointer to the created arena, or NULL on failure
+ */
+rb_arena_t *rb_arena_create(size_t slab_size)
+{
+	rb_arena_t *arena = NULL;
+
+	arena = malloc(sizeof(rb_arena_t));
+	if (arena == NULL)
+		return (NULL);
+
+	arena->slabs = NULL;
+	arena->free_list = NULL;
+	arena->slab_size = slab_size ? slab_size : RB_ARENA_SLAB;
+	return (arena);
+}
+
+/**
+ * rb_arena_grow - adds an empty slab to an arena
+ *
+ * @arena: pointer to the arena
+ *
+ * Return: pointer to the new slab, or NULL on failure
+ */
+rb_slab_t *rb_arena_grow(rb_arena_t *arena)
+{
+	rb_slab_t *slab = NULL;
+
+	slab = malloc(sizeof(rb_slab_t) + sizeof(rb_tree_t) * arena->slab_size);
+	if (slab == NULL)
+		return (NULL);
+
+	slab->nodes = (rb_tree_t *)(slab + 1);
+	slab->used = 0;
+	slab->next = arena->slabs;
+	arena->slabs = slab;
+	return (slab);
+}
+
+/**
+ * rb_arena_node - creates a Red-Black Tree node from an arena
+ *
+ * Recycled nodes are handed out first, then the next unused node of the
+ * current slab. A new slab is only allocated when both are exhausted.
+ *
+ * @arena: pointer to the arena
+ * @parent: Parent
+ * @value: New node value
+ * @color: Node Color
+ *
+ * Return: A new node on success, NULL otherwise
+ */
+rb_tree_t *rb_arena_node(rb_arena_t *arena, rb_tree_t *parent, int value,
+			 rb_color_t color)
+{
+	rb_tree_t *new_node = NULL;
+	rb_slab_t *slab = NULL;
+
+	if (arena == NULL)
+		return (NULL);
+
+	if (arena->free_list)
+	{
+		new_node = arena->free_list;
+		arena->free_list = new_node->parent;
+	}
+	else
+	{
+		slab = arena->slabs;
+		if (slab == NULL || slab->used == arena->slab_size)
+			slab = rb_arena_grow(arena);
+		if (slab == NULL)
+			return (NULL);
+		new_node = &slab->nodes[slab->used++];
+	}
+	new_node->parent = parent;
+	new_node->n = value;
+	new_node->color = color;
+	new_node->left = NULL;
+	new_node->right = NULL;
+	new_node->size = 1;
+	return (new_node);
+}
+
+/**
+ * rb_arena_release - gives a node back to the arena it came from
+ *
+ * @arena: pointer to the arena
+ * @node: node to recycle, linked into the free list through its parent
+ */
+void rb_arena_release(rb_arena_t *arena, rb_tree_t *node)
+{
+	if (arena == NULL || node == NULL)
+		return;
+	node->left = NULL;
+	node->right = NULL;
+	node->parent = arena->free_list;
+	arena->free_list = node;
+}
+
+/**
+ * rb_arena_destroy - frees an arena and every tree built from it
+ *
+ * @arena: pointer to the arena
+ */
+void rb_arena_destroy(rb_arena_t *arena)
+{
+	rb_slab_t *slab = NULL;
+
+	if (arena == NULL)
+		return;
+	while (arena->slabs)
+	{
+		slab = arena->slabs;
+		arena->slabs = slab->next;
+		free(slab);
+	}
+	free(arena);
+}
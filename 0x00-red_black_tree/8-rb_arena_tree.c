@@ -0,0 +1,66 @@
+#include "rb_trees.h"
+
+/**
+ * rb_arena_insert - inserts a value in a Red-Black Tree bound to an arena
+ *
+ * @arena: pointer to the arena the nodes of the tree come from
+ * @tree: double pointer to root node of Red-Black tree to insert the value in
+ * @value: the value to store in the node to be inserted
+ *
+ * Return: pointer to created node, or NULL on failure
+ */
+rb_tree_t *rb_arena_insert(rb_arena_t *arena, rb_tree_t **tree, int value)
+{
+	rb_tree_t **slot = NULL;
+	rb_tree_t *parent = NULL;
+	rb_tree_t *new = NULL;
+
+	if (!arena || !tree)
+		return (NULL);
+
+	slot = rb_tree_slot(tree, value, &parent);
+	if (!slot)
+		return (NULL);
+	new = rb_arena_node(arena, parent, value, RED);
+	if (!new)
+		return (NULL);
+
+	*slot = new;
+	rb_tree_resize(parent, 1);
+	rb_insert_fixup(tree, new);
+	return (new);
+}
+
+/**
+ * rb_arena_remove - removes a node from a Red-Black Tree bound to an arena
+ *
+ * The removed node goes back to the free list of @arena.
+ *
+ * @arena: pointer to the arena the nodes of the tree come from
+ * @root: pointer to root node of tree
+ * @n: value to search for and remove from tree
+ *
+ * Return: pointer to new root of the tree after removal
+ */
+rb_tree_t *rb_arena_remove(rb_arena_t *arena, rb_tree_t *root, int n)
+{
+	rb_tree_t *remove = root;
+	size_t depth = 0;
+
+	while (remove)
+	{
+		RB_STAT(comparisons, 1);
+		RB_STAT_DEPTH(depth);
+		if (remove->n == n)
+			break;
+		if (remove->n > n)
+			remove = remove->left;
+		else
+			remove = remove->right;
+	}
+	if (remove == NULL)
+		return (root);
+	root = rb_tree_delete(root, remove);
+	rb_arena_release(arena, remove);
+	return (root);
+}
@@ -0,0 +1,58 @@
+#include "rb_trees.h"
+
+/**
+ * rb_tree_select - finds the k-th smallest value of a Red-Black Tree
+ *
+ * @tree: pointer to root node of the tree
+ * @k: number of values smaller than the one to find (0 for the minimum)
+ *
+ * Return: pointer to the node holding the value, or NULL if @k is out of
+ *         range
+ */
+const rb_tree_t *rb_tree_select(const rb_tree_t *tree, size_t k)
+{
+	size_t left;
+
+	while (tree != NULL)
+	{
+		left = RB_SIZE(tree->left);
+		if (k == left)
+			return (tree);
+		if (k < left)
+			tree = tree->left;
+		else
+		{
+			k -= left + 1;
+			tree = tree->right;
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * rb_tree_rank - counts the values of a Red-Black Tree smaller than a value
+ *
+ * The value does not need to be in the tree, so the rank can be used to
+ * compute percentiles. When it is, rb_tree_select(tree, rank) finds it.
+ *
+ * @tree: pointer to root node of the tree
+ * @n: value to rank
+ *
+ * Return: number of values in @tree strictly smaller than @n
+ */
+size_t rb_tree_rank(const rb_tree_t *tree, int n)
+{
+	size_t rank = 0;
+
+	while (tree != NULL)
+	{
+		if (n <= tree->n)
+			tree = tree->left;
+		else
+		{
+			rank += RB_SIZE(tree->left) + 1;
+			tree = tree->right;
+		}
+	}
+	return (rank);
+}
@@ -0,0 +1,36 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define BENCH_HIST_SIZE 1920
+
+/**
+ * struct bench_hist_s - Latency histogram with about 3% relative error
+ *
+ * Values below 64 ns get a bucket each; above, every power of two is
+ * split into 32 buckets.
+ *
+ * @count: Number of samples per bucket
+ * @total: Number of samples
+ */
+typedef struct bench_hist_s
+{
+	uint64_t count[BENCH_HIST_SIZE];
+	uint64_t total;
+} bench_hist_t;
+
+/* bench_util.c */
+uint64_t bench_now_ns(void);
+uint64_t bench_rand(uint64_t *state);
+void bench_shuffle(int *array, size_t size, uint64_t *state);
+int *bench_keys(size_t size, uint64_t seed);
+double bench_ns_per_op(uint64_t start, uint64_t end, size_t ops);
+void bench_hist_reset(bench_hist_t *hist);
+void bench_hist_add(bench_hist_t *hist, uint64_t ns);
+uint64_t bench_hist_percentile(const bench_hist_t *hist, double p);
+
+#endif /* __BENCH_H__ */
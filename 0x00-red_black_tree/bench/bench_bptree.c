@@ -0,0 +1,169 @@
+#include "bench.h"
+#include "../rb_bptree.h"
+
+/*
+ * rb_tree_t against bpt_tree_t on the same keys: insert, lookup, a scan of
+ * 100 consecutive values per lookup key, and remove, for random and for
+ * ascending insertion order.
+ *
+ * gcc -O2 -I. bench/bench_bptree.c bench/bench_util.c 0-rb_tree_node.c \
+ *	2-rb_tree_insert.c 4-rb_tree_remove.c 10-rb_tree_iter.c \
+ *	11-rb_tree_range.c 34-bpt_tree.c 35-bpt_insert.c 36-bpt_remove.c \
+ *	-o bench_bptree
+ * ./bench_bptree [keys]
+ *
+ * Add -DBPT_KEYS=<n> to change the number of keys per B+tree node.
+ */
+
+#define BENCH_SCAN 100
+
+/**
+ * bench_count - range callback counting visited values
+ *
+ * @node: visited node, unused
+ * @data: pointer to the counter
+ */
+static void bench_count(const rb_tree_t *node, void *data)
+{
+	(void)node;
+	(*(size_t *)data)++;
+}
+
+/**
+ * bench_count_value - range callback counting visited values
+ *
+ * @value: visited value, unused
+ * @data: pointer to the counter
+ */
+static void bench_count_value(int value, void *data)
+{
+	(void)value;
+	(*(size_t *)data)++;
+}
+
+/**
+ * bench_bpt_bytes - measures the memory held by the nodes of a B+tree
+ *
+ * @node: subtree root
+ *
+ * Return: number of bytes allocated for the subtree
+ */
+static size_t bench_bpt_bytes(const bpt_node_t *node)
+{
+	size_t bytes;
+	int i;
+
+	if (node == NULL)
+		return (0);
+	if (node->leaf)
+		return (sizeof(bpt_leaf_t));
+	bytes = sizeof(bpt_inner_t);
+	for (i = 0; i <= node->count; i++)
+		bytes += bench_bpt_bytes(BPT_INNER(node)->child[i]);
+	return (bytes);
+}
+
+/**
+ * bench_rb - times rb_tree_t
+ *
+ * @keys: keys to use, in insertion order
+ * @probe: keys to look up
+ * @size: number of keys
+ */
+static void bench_rb(const int *keys, const int *probe, size_t size)
+{
+	rb_tree_t *root = NULL;
+	uint64_t t0, t1, t2, t3, t4;
+	size_t i, found = 0, seen = 0;
+
+	t0 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		rb_tree_insert(&root, keys[i]);
+	t1 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		found += rb_tree_find(root, probe[i]) != NULL;
+	t2 = bench_now_ns();
+	for (i = 0; i < size / BENCH_SCAN; i++)
+		rb_tree_range(root, probe[i], probe[i] + BENCH_SCAN - 1,
+			      bench_count, &seen);
+	t3 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		root = rb_tree_remove(root, keys[i]);
+	t4 = bench_now_ns();
+	printf("rb_tree_t   %5.1f B/key  insert %7.1f  find %7.1f  scan %7.1f"
+	       "  remove %7.1f ns/op (%lu found, %lu scanned)\n",
+	       (double)sizeof(rb_tree_t), bench_ns_per_op(t0, t1, size),
+	       bench_ns_per_op(t1, t2, size), bench_ns_per_op(t2, t3, seen),
+	       bench_ns_per_op(t3, t4, size), (unsigned long)found,
+	       (unsigned long)seen);
+}
+
+/**
+ * bench_bpt - times bpt_tree_t
+ *
+ * @keys: keys to use, in insertion order
+ * @probe: keys to look up
+ * @size: number of keys
+ */
+static void bench_bpt(const int *keys, const int *probe, size_t size)
+{
+	bpt_tree_t *tree = bpt_tree_create();
+	uint64_t t0, t1, t2, t3, t4;
+	size_t i, found = 0, seen = 0;
+	double bytes;
+
+	if (tree == NULL)
+		return;
+	t0 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		bpt_tree_insert(tree, keys[i]);
+	t1 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		found += bpt_tree_find(tree, probe[i]);
+	t2 = bench_now_ns();
+	for (i = 0; i < size / BENCH_SCAN; i++)
+		bpt_tree_range(tree, probe[i], probe[i] + BENCH_SCAN - 1,
+			       bench_count_value, &seen);
+	t3 = bench_now_ns();
+	bytes = (double)bench_bpt_bytes(tree->root) / (double)size;
+	for (i = 0; i < size; i++)
+		bpt_tree_remove(tree, keys[i]);
+	t4 = bench_now_ns();
+	printf("bpt_tree_t  %5.1f B/key  insert %7.1f  find %7.1f  scan %7.1f"
+	       "  remove %7.1f ns/op (%lu found, %lu scanned)\n", bytes,
+	       bench_ns_per_op(t0, t1, size), bench_ns_per_op(t1, t2, size),
+	       bench_ns_per_op(t2, t3, seen), bench_ns_per_op(t3, t4, size),
+	       (unsigned long)found, (unsigned long)seen);
+	bpt_tree_delete(tree);
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of keys (default 1000000)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, i;
+	int *keys = bench_keys(size, 42), *probe = bench_keys(size, 7);
+	int *sorted = malloc(sizeof(int) * (size ? size : 1));
+
+	if (keys == NULL || probe == NULL || sorted == NULL)
+		return (EXIT_FAILURE);
+	for (i = 0; i < size; i++)
+		sorted[i] = (int)i + 1;
+	printf("%lu random keys, %d keys per B+tree node\n",
+	       (unsigned long)size, BPT_KEYS);
+	bench_rb(keys, probe, size);
+	bench_bpt(keys, probe, size);
+	printf("%lu ascending keys\n", (unsigned long)size);
+	bench_rb(sorted, probe, size);
+	bench_bpt(sorted, probe, size);
+	free(sorted);
+	free(probe);
+	free(keys);
+	return (EXIT_SUCCESS);
+}
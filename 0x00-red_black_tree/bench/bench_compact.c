@@ -0,0 +1,94 @@
+#include "bench.h"
+#include "../rb_compact.h"
+
+/*
+ * Pointer-based rb_tree_t against index-based rbc_tree_t.
+ *
+ * gcc -O2 -I. bench/bench_compact.c bench/bench_util.c 0-rb_tree_node.c \
+ *	2-rb_tree_insert.c 4-rb_tree_remove.c 10-rb_tree_iter.c 11-rb_tree_range.c \
+ *	15-rbc_tree.c 16-rbc_tree_insert.c 17-rbc_tree_remove.c \
+ *	-o bench_compact
+ * ./bench_compact [keys]
+ */
+
+/**
+ * bench_pointer - times insert, lookup and remove on a rb_tree_t
+ *
+ * @keys: keys to use, in insertion order
+ * @size: number of keys
+ */
+static void bench_pointer(const int *keys, size_t size)
+{
+	rb_tree_t *root = NULL;
+	uint64_t t0, t1, t2, t3;
+	size_t i, found = 0;
+
+	t0 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		rb_tree_insert(&root, keys[i]);
+	t1 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		found += rb_tree_find(root, keys[size - 1 - i]) != NULL;
+	t2 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		root = rb_tree_remove(root, keys[i]);
+	t3 = bench_now_ns();
+	printf("rb_tree_t   %2lu B/key  insert %7.1f  find %7.1f  remove %7.1f"
+	       " ns/op (%lu found)\n", (unsigned long)sizeof(rb_tree_t),
+	       bench_ns_per_op(t0, t1, size), bench_ns_per_op(t1, t2, size),
+	       bench_ns_per_op(t2, t3, size), (unsigned long)found);
+}
+
+/**
+ * bench_compact - times insert, lookup and remove on a rbc_tree_t
+ *
+ * @keys: keys to use, in insertion order
+ * @size: number of keys
+ */
+static void bench_compact(const int *keys, size_t size)
+{
+	rbc_tree_t *tree = rbc_tree_create(size);
+	uint64_t t0, t1, t2, t3;
+	size_t i, found = 0;
+
+	if (tree == NULL)
+		return;
+	t0 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		rbc_tree_insert(tree, keys[i]);
+	t1 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		found += rbc_tree_find(tree, keys[size - 1 - i]) != RBC_NIL;
+	t2 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		rbc_tree_remove(tree, keys[i]);
+	t3 = bench_now_ns();
+	printf("rbc_tree_t  %2lu B/key  insert %7.1f  find %7.1f  remove %7.1f"
+	       " ns/op (%lu found)\n",
+	       (unsigned long)(sizeof(rbc_node_t) + sizeof(int)),
+	       bench_ns_per_op(t0, t1, size), bench_ns_per_op(t1, t2, size),
+	       bench_ns_per_op(t2, t3, size), (unsigned long)found);
+	rbc_tree_delete(tree);
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of keys (default 1000000)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+	int *keys = bench_keys(size, 42);
+
+	if (keys == NULL)
+		return (EXIT_FAILURE);
+	printf("%lu random keys\n", (unsigned long)size);
+	bench_pointer(keys, size);
+	bench_compact(keys, size);
+	free(keys);
+	return (EXIT_SUCCESS);
+}
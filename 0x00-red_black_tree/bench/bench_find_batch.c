@@ -0,0 +1,65 @@
+#include "bench.h"
+#include "../rb_trees.h"
+
+/*
+ * Independent rb_tree_find calls against interleaved rb_tree_find_batch
+ * on a tree much larger than the last level cache (40 bytes per key).
+ * Half of the probed values are in the tree.
+ *
+ * gcc -O2 -I. bench/bench_find_batch.c bench/bench_util.c 0-rb_tree_node.c \
+ *	2-rb_tree_insert.c 6-sorted_array_to_rb_tree.c 10-rb_tree_iter.c \
+ *	11-rb_tree_range.c 29-rb_tree_find_batch.c -o bench_find_batch
+ * ./bench_find_batch [keys] [batch]
+ *
+ * Add -DRB_FIND_GROUP=<n> to change the number of searches in flight.
+ */
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of keys (default 4000000) and av[2]
+ *      the number of values per batch (default 1024)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 4000000;
+	size_t batch = ac > 2 ? strtoul(av[2], NULL, 10) : 1024;
+	int *keys = bench_keys(size * 2, 42), *probe = bench_keys(size * 2, 7);
+	const rb_tree_t **out = malloc(sizeof(*out) * size);
+	rb_tree_t *root = NULL;
+	size_t i, found = 0, batched = 0, mismatch = 0;
+	uint64_t t0, t1, t2;
+
+	if (keys == NULL || probe == NULL || out == NULL || batch == 0)
+		return (EXIT_FAILURE);
+	for (i = 0; i < size; i++)
+		rb_tree_insert(&root, keys[i]);
+
+	t0 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		found += rb_tree_find(root, probe[i]) != NULL;
+	t1 = bench_now_ns();
+	for (i = 0; i < size; i += batch)
+		batched += rb_tree_find_batch(root, probe + i,
+					      size - i < batch ? size - i : batch,
+					      out + i);
+	t2 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		mismatch += out[i] != rb_tree_find(root, probe[i]);
+
+	printf("%lu keys, batches of %lu, %d searches in flight\n",
+	       (unsigned long)size, (unsigned long)batch, RB_FIND_GROUP);
+	printf("rb_tree_find        %7.1f ns/op (%lu found)\n",
+	       bench_ns_per_op(t0, t1, size), (unsigned long)found);
+	printf("rb_tree_find_batch  %7.1f ns/op (%lu found, %lu mismatches)\n",
+	       bench_ns_per_op(t1, t2, size), (unsigned long)batched,
+	       (unsigned long)mismatch);
+	rb_build_free(root);
+	free(out);
+	free(probe);
+	free(keys);
+	return (mismatch ? EXIT_FAILURE : EXIT_SUCCESS);
+}
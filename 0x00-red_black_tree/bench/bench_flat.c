@@ -0,0 +1,75 @@
+#include "bench.h"
+#include "../rb_flat.h"
+
+/*
+ * Flat Red-Black tree files: saving, mapping, lookups straight from the
+ * mapping, and reloading into a mutable tree, against rebuilding the same
+ * tree by insertion.
+ *
+ * gcc -O2 -I. bench/bench_flat.c bench/bench_util.c 0-rb_tree_node.c \
+ *	2-rb_tree_insert.c 4-rb_tree_remove.c 6-sorted_array_to_rb_tree.c \
+ *	10-rb_tree_iter.c 11-rb_tree_range.c 41-rb_flat_save.c \
+ *	42-rb_flat_open.c 43-rb_flat_to_rb_tree.c -o bench_flat
+ * ./bench_flat [keys] [path]
+ */
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of keys (default 1000000) and av[2]
+ *      the file to write (default rb_flat.bin)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+	const char *path = ac > 2 ? av[2] : "rb_flat.bin";
+	int *keys = bench_keys(size, 42);
+	rb_tree_t *root = NULL, *back;
+	rb_flat_t *flat;
+	uint64_t t0, t1, t2, t3;
+	size_t i, found = 0;
+
+	if (keys == NULL || size == 0)
+		return (EXIT_FAILURE);
+	t0 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		rb_tree_insert(&root, keys[i]);
+	t1 = bench_now_ns();
+	for (i = 0; i < size; i++)
+		found += rb_tree_find(root, keys[size - 1 - i]) != NULL;
+	t2 = bench_now_ns();
+	printf("%lu random keys, %lu found\n", (unsigned long)size,
+	       (unsigned long)found);
+	printf("rb_tree_t  build %8.1f ms  find %7.1f ns/op\n",
+	       (t1 - t0) / 1e6, bench_ns_per_op(t1, t2, size));
+
+	t0 = bench_now_ns();
+	if (rb_flat_save(root, path) != 1)
+		return (EXIT_FAILURE);
+	t1 = bench_now_ns();
+	flat = rb_flat_open(path);
+	t2 = bench_now_ns();
+	if (flat == NULL)
+		return (EXIT_FAILURE);
+	found = 0;
+	for (i = 0; i < size; i++)
+		found += rb_flat_find(flat, keys[size - 1 - i]);
+	t3 = bench_now_ns();
+	printf("rb_flat_t  save  %8.1f ms  open %7.3f ms  find %7.1f ns/op"
+	       " (%lu found)\n", (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+	       bench_ns_per_op(t2, t3, size), (unsigned long)found);
+
+	t0 = bench_now_ns();
+	back = rb_flat_to_rb_tree(flat);
+	t1 = bench_now_ns();
+	printf("rb_flat_to_rb_tree %8.1f ms\n", (t1 - t0) / 1e6);
+	rb_build_free(back);
+	rb_flat_close(flat);
+	rb_build_free(root);
+	remove(path);
+	free(keys);
+	return (EXIT_SUCCESS);
+}
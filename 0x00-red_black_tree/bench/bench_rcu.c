@@ -0,0 +1,207 @@
+#include <pthread.h>
+#include "bench.h"
+#include "../rb_trees.h"
+#include "../rb_rcu.h"
+
+/*
+ * Lookup throughput with one concurrent writer: rb_rcu_t readers against
+ * a rb_tree_t behind a single mutex. Both trees hold the same keys; the
+ * writer keeps removing and reinserting random keys while readers look up
+ * random keys.
+ *
+ * gcc -O2 -pthread -I. bench/bench_rcu.c bench/bench_util.c 0-rb_tree_node.c \
+ *	2-rb_tree_insert.c 4-rb_tree_remove.c 6-sorted_array_to_rb_tree.c \
+ *	10-rb_tree_iter.c 11-rb_tree_range.c 21-rbp_tree.c 22-rbp_op.c \
+ *	23-rbp_insert.c 24-rbp_remove.c \
+ *	26-rb_rcu.c 27-rb_rcu_read.c 28-rb_rcu_write.c -o bench_rcu
+ * ./bench_rcu [keys] [milliseconds]
+ */
+
+#define BENCH_MAX_THREADS 16
+
+/**
+ * struct bench_rcu_s - Shared state of one run
+ *
+ * @rcu: tree used by the RCU run, NULL for the mutex run
+ * @root: tree used by the mutex run
+ * @lock: protects @root
+ * @size: keys are in [1, @size * 2]
+ * @stop: set to end the run
+ */
+typedef struct bench_rcu_s
+{
+	rb_rcu_t *rcu;
+	rb_tree_t *root;
+	pthread_mutex_t lock;
+	size_t size;
+	int stop;
+} bench_rcu_t;
+
+/**
+ * struct bench_worker_s - Per-thread state
+ *
+ * @bench: shared state
+ * @seed: state of the thread's random generator
+ * @ops: number of operations done
+ * @hits: number of lookups that found their key
+ */
+typedef struct bench_worker_s
+{
+	bench_rcu_t *bench;
+	uint64_t seed;
+	size_t ops;
+	size_t hits;
+} bench_worker_t;
+
+/**
+ * bench_reader - looks up random keys until the run ends
+ *
+ * @arg: pointer to the worker state
+ *
+ * Return: NULL
+ */
+static void *bench_reader(void *arg)
+{
+	bench_worker_t *w = arg;
+	bench_rcu_t *b = w->bench;
+	int reader = b->rcu ? rb_rcu_register(b->rcu) : -1;
+	int key;
+
+	while (!__atomic_load_n(&b->stop, __ATOMIC_RELAXED))
+	{
+		key = (int)(bench_rand(&w->seed) % (b->size * 2)) + 1;
+		if (b->rcu)
+			w->hits += rb_rcu_find(b->rcu, reader, key);
+		else
+		{
+			pthread_mutex_lock(&b->lock);
+			w->hits += rb_tree_find(b->root, key) != NULL;
+			pthread_mutex_unlock(&b->lock);
+		}
+		w->ops++;
+	}
+	if (b->rcu)
+		rb_rcu_unregister(b->rcu, reader);
+	return (NULL);
+}
+
+/**
+ * bench_writer - removes and reinserts random keys until the run ends
+ *
+ * @arg: pointer to the worker state
+ *
+ * Return: NULL
+ */
+static void *bench_writer(void *arg)
+{
+	bench_worker_t *w = arg;
+	bench_rcu_t *b = w->bench;
+	int key;
+
+	while (!__atomic_load_n(&b->stop, __ATOMIC_RELAXED))
+	{
+		key = (int)(bench_rand(&w->seed) % (b->size * 2)) + 1;
+		if (b->rcu)
+		{
+			if (rb_rcu_remove(b->rcu, key) == 1)
+				rb_rcu_insert(b->rcu, key);
+		}
+		else
+		{
+			pthread_mutex_lock(&b->lock);
+			if (rb_tree_find(b->root, key))
+			{
+				b->root = rb_tree_remove(b->root, key);
+				rb_tree_insert(&b->root, key);
+			}
+			pthread_mutex_unlock(&b->lock);
+		}
+		w->ops++;
+	}
+	return (NULL);
+}
+
+/**
+ * bench_run - runs readers and one writer for a fixed time
+ *
+ * @b: shared state, filled with keys
+ * @threads: number of reader threads
+ * @ms: duration of the run in milliseconds
+ * @name: label of the run
+ */
+static void bench_run(bench_rcu_t *b, int threads, long ms, const char *name)
+{
+	pthread_t tid[BENCH_MAX_THREADS + 1];
+	bench_worker_t w[BENCH_MAX_THREADS + 1];
+	struct timespec pause;
+	size_t reads = 0;
+	uint64_t t0, t1;
+	int i;
+
+	b->stop = 0;
+	pause.tv_sec = ms / 1000;
+	pause.tv_nsec = (ms % 1000) * 1000000;
+	t0 = bench_now_ns();
+	for (i = 0; i <= threads; i++)
+	{
+		w[i].bench = b;
+		w[i].seed = 0x9e3779b97f4a7c15UL + (uint64_t)i;
+		w[i].ops = 0;
+		w[i].hits = 0;
+		pthread_create(&tid[i], NULL, i ? bench_reader : bench_writer,
+			       &w[i]);
+	}
+	nanosleep(&pause, NULL);
+	__atomic_store_n(&b->stop, 1, __ATOMIC_RELAXED);
+	for (i = 0; i <= threads; i++)
+		pthread_join(tid[i], NULL);
+	t1 = bench_now_ns();
+	for (i = 1; i <= threads; i++)
+		reads += w[i].ops;
+	printf("%-6s %2d readers  %10.0f lookups/s  %9.0f updates/s\n", name,
+	       threads, reads * 1e9 / (t1 - t0), w[0].ops * 1e9 / (t1 - t0));
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of keys (default 1000000) and av[2]
+ *      the duration of each run in milliseconds (default 1000)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+	long ms = ac > 2 ? strtol(av[2], NULL, 10) : 1000;
+	int *keys = bench_keys(size * 2, 42);
+	bench_rcu_t b;
+	size_t i;
+	int threads;
+
+	if (keys == NULL || size == 0)
+		return (EXIT_FAILURE);
+	b.size = size;
+	b.root = NULL;
+	b.rcu = NULL;
+	pthread_mutex_init(&b.lock, NULL);
+	for (i = 0; i < size; i++)
+		rb_tree_insert(&b.root, keys[i]);
+	printf("%lu keys, one writer\n", (unsigned long)size);
+	for (threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+		bench_run(&b, threads, ms, "mutex");
+	rb_build_free(b.root);
+
+	b.rcu = rb_rcu_create();
+	if (b.rcu == NULL)
+		return (EXIT_FAILURE);
+	for (i = 0; i < size; i++)
+		rb_rcu_insert(b.rcu, keys[i]);
+	for (threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+		bench_run(&b, threads, ms, "rcu");
+	rb_rcu_destroy(b.rcu);
+	pthread_mutex_destroy(&b.lock);
+	free(keys);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,145 @@
+#include <pthread.h>
+#include "bench.h"
+#include "../rb_shard.h"
+
+/*
+ * Insert throughput of rb_shards_t against a rb_tree_t behind a single
+ * mutex. Each thread inserts its own slice of the keys; "random" keys are
+ * spread over the whole range while "ascending" keys all land past the
+ * largest value, the worst case for the boundaries, which rebalancing has
+ * to keep moving.
+ *
+ * gcc -O2 -pthread -I. bench/bench_shards.c bench/bench_util.c \
+ *	0-rb_tree_node.c 2-rb_tree_insert.c 4-rb_tree_remove.c \
+ *	6-sorted_array_to_rb_tree.c 9-rb_tree_order_stat.c 10-rb_tree_iter.c \
+ *	11-rb_tree_range.c 12-rb_tree_join.c 13-rb_tree_split.c \
+ *	44-rb_shards.c 45-rb_shards_rebalance.c 46-rb_shards_range.c \
+ *	-o bench_shards
+ * ./bench_shards [keys] [shards]
+ */
+
+#define BENCH_MAX_THREADS 16
+
+/**
+ * struct bench_shards_s - Per-thread state of one run
+ *
+ * @shards: tree used by the sharded run, NULL for the mutex run
+ * @root: tree used by the mutex run
+ * @lock: protects @root
+ * @keys: keys of the thread
+ * @size: number of keys of the thread
+ */
+typedef struct bench_shards_s
+{
+	rb_shards_t *shards;
+	rb_tree_t **root;
+	pthread_mutex_t *lock;
+	const int *keys;
+	size_t size;
+} bench_shards_t;
+
+/**
+ * bench_insert - inserts the keys of a thread
+ *
+ * @arg: pointer to the thread state
+ *
+ * Return: NULL
+ */
+static void *bench_insert(void *arg)
+{
+	bench_shards_t *w = arg;
+	size_t i;
+
+	for (i = 0; i < w->size; i++)
+	{
+		if (w->shards)
+			rb_shards_insert(w->shards, w->keys[i]);
+		else
+		{
+			pthread_mutex_lock(w->lock);
+			rb_tree_insert(w->root, w->keys[i]);
+			pthread_mutex_unlock(w->lock);
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * bench_run - inserts all keys with a number of threads
+ *
+ * @keys: keys to insert
+ * @size: number of keys
+ * @threads: number of threads
+ * @shards: number of shards, 0 for the mutex run
+ *
+ * Return: throughput in insertions per second
+ */
+static double bench_run(const int *keys, size_t size, int threads,
+			size_t shards)
+{
+	pthread_t tid[BENCH_MAX_THREADS];
+	bench_shards_t w[BENCH_MAX_THREADS];
+	pthread_mutex_t lock;
+	rb_tree_t *root = NULL;
+	rb_shards_t *tree = NULL;
+	uint64_t t0, t1;
+	int i;
+
+	pthread_mutex_init(&lock, NULL);
+	if (shards)
+		tree = rb_shards_create(shards, 1, (int)size);
+	t0 = bench_now_ns();
+	for (i = 0; i < threads; i++)
+	{
+		w[i].shards = tree;
+		w[i].root = &root;
+		w[i].lock = &lock;
+		w[i].keys = keys + size * i / threads;
+		w[i].size = size * (i + 1) / threads - size * i / threads;
+		pthread_create(&tid[i], NULL, bench_insert, &w[i]);
+	}
+	for (i = 0; i < threads; i++)
+		pthread_join(tid[i], NULL);
+	t1 = bench_now_ns();
+	rb_shards_destroy(tree);
+	rb_build_free(root);
+	pthread_mutex_destroy(&lock);
+	return (size * 1e9 / (t1 - t0));
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of keys (default 1000000) and av[2]
+ *      the number of shards (default 64)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+	size_t shards = ac > 2 ? strtoul(av[2], NULL, 10) : 64;
+	int *keys = bench_keys(size, 42);
+	int threads, order;
+	size_t i;
+
+	if (keys == NULL || size == 0 || shards == 0)
+		return (EXIT_FAILURE);
+	printf("%lu keys, %lu shards, inserts/s\n", (unsigned long)size,
+	       (unsigned long)shards);
+	for (order = 0; order < 2; order++)
+	{
+		if (order)
+			for (i = 0; i < size; i++)
+				keys[i] = (int)(i % BENCH_MAX_THREADS * size /
+					  BENCH_MAX_THREADS + i / BENCH_MAX_THREADS) + 1;
+		for (threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+			printf("%-9s %2d threads  mutex %10.0f  shards %10.0f\n",
+			       order ? "ascending" : "random", threads,
+			       bench_run(keys, size, threads, 0),
+			       bench_run(keys, size, threads, shards));
+	}
+	free(keys);
+	return (EXIT_SUCCESS);
+}
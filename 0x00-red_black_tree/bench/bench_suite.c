@@ -0,0 +1,300 @@
+#include <math.h>
+#include <sys/resource.h>
+#include "bench.h"
+#include "../rb_trees.h"
+
+/*
+ * Reproducible rb_tree_t workloads, reported as JSON on stdout.
+ *
+ * For every size, from min to max keys by powers of 10, and every workload,
+ * four phases of n operations each are timed:
+ *   insert  every key once, in workload order
+ *   lookup  n lookups drawn from the workload
+ *   mix     80% lookups, 10% removals and 10% insertions
+ *   remove  every key once, in workload order
+ *
+ * Workloads:
+ *   sequential  keys in ascending order
+ *   random      keys in a random order
+ *   zipf        random insertion order, lookups Zipf-distributed (0.99)
+ *   sawtooth    SUITE_RAMPS ascending ramps interleaved over the key range
+ *
+ * Each operation is timed on its own, with the cost of reading the clock
+ * subtracted, and ns_per_op is the mean of those times. peak_rss_kb is the
+ * peak of the whole process so far. 1e8 keys needs about 5 GB of memory.
+ *
+ * gcc -O2 -I. bench/bench_suite.c bench/bench_util.c 0-rb_tree_node.c \
+ *	2-rb_tree_insert.c 4-rb_tree_remove.c 6-sorted_array_to_rb_tree.c \
+ *	10-rb_tree_iter.c 11-rb_tree_range.c -lm -o bench_suite
+ * ./bench_suite [min_keys] [max_keys] [seed] > results.json
+ */
+
+#define SUITE_RAMPS 16
+#define SUITE_THETA 0.99
+#define SUITE_MIX 10
+
+/**
+ * struct suite_zipf_s - Zipf generator over ranks 0..n-1
+ *
+ * Gray et al., "Quickly Generating Billion-Record Synthetic Databases".
+ *
+ * @n: Number of ranks
+ * @alpha: 1 / (1 - theta)
+ * @zetan: Sum of 1 / i^theta for i in 1..n
+ * @eta: Precomputed scale of the tail
+ * @half: 0.5^theta
+ */
+typedef struct suite_zipf_s
+{
+	size_t n;
+	double alpha;
+	double zetan;
+	double eta;
+	double half;
+} suite_zipf_t;
+
+/**
+ * struct suite_s - State of a run
+ *
+ * @root: Tree under test
+ * @order: Insertion and removal order
+ * @probe: Lookup keys
+ * @size: Number of keys
+ * @seed: Generator state
+ * @overhead: Cost of timing one operation, in ns
+ * @hist: Latencies of the current phase
+ * @records: Number of JSON records printed
+ */
+typedef struct suite_s
+{
+	rb_tree_t *root;
+	int *order;
+	int *probe;
+	size_t size;
+	uint64_t seed;
+	uint64_t overhead;
+	bench_hist_t hist;
+	size_t records;
+} suite_t;
+
+static const char * const workloads[] = {
+	"sequential", "random", "zipf", "sawtooth"
+};
+static const char * const phases[] = {"insert", "lookup", "mix", "remove"};
+
+/**
+ * suite_zipf_init - prepares a Zipf generator
+ *
+ * @z: generator to prepare
+ * @n: number of ranks
+ */
+static void suite_zipf_init(suite_zipf_t *z, size_t n)
+{
+	size_t i;
+
+	z->n = n;
+	z->alpha = 1.0 / (1.0 - SUITE_THETA);
+	z->half = pow(0.5, SUITE_THETA);
+	z->zetan = 0;
+	for (i = 1; i <= n; i++)
+		z->zetan += 1.0 / pow((double)i, SUITE_THETA);
+	z->eta = (1.0 - pow(2.0 / (double)n, 1.0 - SUITE_THETA)) /
+		 (1.0 - (1.0 + z->half) / z->zetan);
+}
+
+/**
+ * suite_zipf_next - draws a Zipf-distributed rank
+ *
+ * @z: generator
+ * @state: bench_rand state
+ *
+ * Return: rank in [0, n), 0 being the most frequent
+ */
+static size_t suite_zipf_next(const suite_zipf_t *z, uint64_t *state)
+{
+	double u = (double)(bench_rand(state) >> 11) / 9007199254740992.0;
+	double uz = u * z->zetan;
+	size_t rank;
+
+	if (uz < 1.0)
+		return (0);
+	if (uz < 1.0 + z->half)
+		return (1);
+	rank = (size_t)((double)z->n *
+			pow(z->eta * u - z->eta + 1.0, z->alpha));
+	return (rank < z->n ? rank : z->n - 1);
+}
+
+/**
+ * suite_keys - fills the insertion order and lookup keys of a workload
+ *
+ * @s: state of the run, @s->size set
+ * @workload: index in workloads
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int suite_keys(suite_t *s, int workload)
+{
+	suite_zipf_t zipf;
+	size_t i, j = 0, r;
+	int *perm;
+
+	s->order = bench_keys(s->size, s->seed);
+	s->probe = bench_keys(s->size, s->seed + 1);
+	if (s->order == NULL || s->probe == NULL)
+		return (0);
+	if (workload == 0)
+		for (i = 0; i < s->size; i++)
+			s->order[i] = (int)i + 1;
+	if (workload == 3)
+		for (r = 0; r < SUITE_RAMPS; r++)
+			for (i = r; i < s->size; i += SUITE_RAMPS)
+				s->order[j++] = (int)i + 1;
+	if (workload == 0 || workload == 3)
+		for (i = 0; i < s->size; i++)
+			s->probe[i] = s->order[i];
+	if (workload == 2)
+	{
+		perm = s->probe;
+		s->probe = malloc(sizeof(int) * s->size);
+		if (s->probe == NULL)
+		{
+			s->probe = perm;
+			return (0);
+		}
+		suite_zipf_init(&zipf, s->size);
+		for (i = 0; i < s->size; i++)
+			s->probe[i] = perm[suite_zipf_next(&zipf, &s->seed)];
+		free(perm);
+	}
+	return (1);
+}
+
+/**
+ * suite_phase - times one phase and records its per-operation latencies
+ *
+ * @s: state of the run
+ * @phase: index in phases, or -1 to time an empty operation
+ *
+ * Return: time spent in the operations, in ns
+ */
+static uint64_t suite_phase(suite_t *s, int phase)
+{
+	uint64_t start, end, busy = 0, mix = 0;
+	size_t i;
+
+	bench_hist_reset(&s->hist);
+	for (i = 0; i < s->size; i++)
+	{
+		if (phase == 2)
+			mix = bench_rand(&s->seed) % SUITE_MIX;
+		start = bench_now_ns();
+		if (phase == 0)
+			rb_tree_insert(&s->root, s->order[i]);
+		else if (phase == 1 || (phase == 2 && mix > 1))
+			rb_tree_find(s->root, s->probe[i]);
+		else if (phase == 2 && mix == 1)
+			rb_tree_insert(&s->root, s->probe[i]);
+		else if (phase == 2)
+			s->root = rb_tree_remove(s->root, s->probe[i]);
+		else if (phase == 3)
+			s->root = rb_tree_remove(s->root, s->order[i]);
+		end = bench_now_ns() - start;
+		end -= end < s->overhead ? end : s->overhead;
+		bench_hist_add(&s->hist, end);
+		busy += end;
+	}
+	return (busy);
+}
+
+/**
+ * suite_record - prints the JSON record of a phase
+ *
+ * @s: state of the run, its histogram filled by suite_phase
+ * @workload: index in workloads
+ * @phase: index in phases
+ * @elapsed: time spent in the operations of the phase, in ns
+ */
+static void suite_record(suite_t *s, int workload, int phase,
+			 uint64_t elapsed)
+{
+	struct rusage usage;
+	double ns = bench_ns_per_op(0, elapsed, s->size);
+
+	getrusage(RUSAGE_SELF, &usage);
+	printf("%s\n    {\"workload\": \"%s\", \"keys\": %lu, \"phase\": \"%s\", "
+	       "\"ops\": %lu, \"ns_per_op\": %.1f, \"p50_ns\": %lu, "
+	       "\"p99_ns\": %lu, \"peak_rss_kb\": %ld}",
+	       s->records++ ? "," : "", workloads[workload],
+	       (unsigned long)s->size, phases[phase], (unsigned long)s->size, ns,
+	       (unsigned long)bench_hist_percentile(&s->hist, 50),
+	       (unsigned long)bench_hist_percentile(&s->hist, 99),
+	       usage.ru_maxrss);
+	fflush(stdout);
+}
+
+/**
+ * suite_run - runs the four phases of a workload at one size
+ *
+ * @s: state of the run
+ * @workload: index in workloads
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int suite_run(suite_t *s, int workload)
+{
+	uint64_t elapsed;
+	int phase, ok;
+
+	ok = suite_keys(s, workload);
+	if (ok)
+	{
+		s->overhead = 0;
+		suite_phase(s, -1);
+		s->overhead = bench_hist_percentile(&s->hist, 50);
+		for (phase = 0; phase < 4; phase++)
+		{
+			elapsed = suite_phase(s, phase);
+			suite_record(s, workload, phase, elapsed);
+		}
+	}
+	rb_build_free(s->root);
+	s->root = NULL;
+	free(s->order);
+	free(s->probe);
+	return (ok);
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] and av[2] are the smallest and largest number of
+ *      keys (default 1000 and 1000000), av[3] the seed (default 42)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t min = ac > 1 ? strtoul(av[1], NULL, 10) : 1000;
+	size_t max = ac > 2 ? strtoul(av[2], NULL, 10) : 1000000;
+	uint64_t seed = ac > 3 ? strtoul(av[3], NULL, 10) : 42;
+	suite_t *s = malloc(sizeof(suite_t));
+	int workload, ok = 1;
+
+	if (s == NULL || min == 0)
+		return (EXIT_FAILURE);
+	s->root = NULL;
+	s->records = 0;
+	printf("{\"bench\": \"rb_tree\", \"seed\": %lu, \"results\": [",
+	       (unsigned long)seed);
+	for (s->size = min; ok && s->size <= max; s->size *= 10)
+		for (workload = 0; ok && workload < 4; workload++)
+		{
+			s->seed = seed ? seed : 1;
+			ok = suite_run(s, workload);
+		}
+	printf("\n]}\n");
+	free(s);
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,147 @@
+#include "bench.h"
+
+/**
+ * bench_now_ns - reads a monotonic clock
+ *
+ * Return: current time in nanoseconds
+ */
+uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * (uint64_t)1000000000 + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * bench_rand - xorshift64* pseudo-random generator, reproducible per seed
+ *
+ * @state: generator state, must not be 0
+ *
+ * Return: next pseudo-random number
+ */
+uint64_t bench_rand(uint64_t *state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return (*state * (uint64_t)2685821657736338717UL);
+}
+
+/**
+ * bench_shuffle - shuffles an array in place (Fisher-Yates)
+ *
+ * @array: array to shuffle
+ * @size: number of elements in @array
+ * @state: generator state
+ */
+void bench_shuffle(int *array, size_t size, uint64_t *state)
+{
+	size_t i, j;
+	int tmp;
+
+	for (i = size; i > 1; i--)
+	{
+		j = bench_rand(state) % i;
+		tmp = array[i - 1];
+		array[i - 1] = array[j];
+		array[j] = tmp;
+	}
+}
+
+/**
+ * bench_keys - builds a random permutation of 1..size
+ *
+ * @size: number of keys
+ * @seed: generator seed
+ *
+ * Return: malloc'd array of keys, or NULL on failure
+ */
+int *bench_keys(size_t size, uint64_t seed)
+{
+	int *keys = malloc(sizeof(int) * (size ? size : 1));
+	size_t i;
+
+	if (keys == NULL)
+		return (NULL);
+	for (i = 0; i < size; i++)
+		keys[i] = (int)i + 1;
+	seed = seed ? seed : 1;
+	bench_shuffle(keys, size, &seed);
+	return (keys);
+}
+
+/**
+ * bench_ns_per_op - converts a measured interval into ns per operation
+ *
+ * @start: start time in ns
+ * @end: end time in ns
+ * @ops: number of operations run in the interval
+ *
+ * Return: mean time of one operation, in ns
+ */
+double bench_ns_per_op(uint64_t start, uint64_t end, size_t ops)
+{
+	return (ops ? (double)(end - start) / (double)ops : 0.0);
+}
+
+/**
+ * bench_hist_reset - empties a latency histogram
+ *
+ * @hist: histogram to empty
+ */
+void bench_hist_reset(bench_hist_t *hist)
+{
+	size_t i;
+
+	for (i = 0; i < BENCH_HIST_SIZE; i++)
+		hist->count[i] = 0;
+	hist->total = 0;
+}
+
+/**
+ * bench_hist_add - records one latency sample
+ *
+ * @hist: histogram to update
+ * @ns: sample, in ns
+ */
+void bench_hist_add(bench_hist_t *hist, uint64_t ns)
+{
+	int bit = 63;
+
+	hist->total++;
+	if (ns < 64)
+	{
+		hist->count[ns]++;
+		return;
+	}
+	while (!(ns >> bit))
+		bit--;
+	hist->count[64 + (bit - 6) * 32 + ((ns >> (bit - 5)) & 31)]++;
+}
+
+/**
+ * bench_hist_percentile - reads a percentile from a latency histogram
+ *
+ * @hist: histogram to read
+ * @p: percentile, between 0 and 100
+ *
+ * Return: lower bound of the bucket holding the percentile, in ns
+ */
+uint64_t bench_hist_percentile(const bench_hist_t *hist, double p)
+{
+	uint64_t rank = (uint64_t)((double)hist->total * p / 100.0), seen = 0;
+	size_t i;
+
+	for (i = 0; i < BENCH_HIST_SIZE; i++)
+	{
+		seen += hist->count[i];
+		if (seen > rank)
+			break;
+	}
+	if (i >= BENCH_HIST_SIZE)
+		i = BENCH_HIST_SIZE - 1;
+	if (i < 64)
+		return (i);
+	return ((uint64_t)(32 + (i - 64) % 32) << ((i - 64) / 32 + 1));
+}
@@ -0,0 +1,103 @@
+#ifndef __RB_BPTREE_H__
+#define __RB_BPTREE_H__
+
+#include <string.h>
+#include "rb_trees.h"
+
+/* 60 keys make a 256-byte leaf, four cache lines */
+#ifndef BPT_KEYS
+#define BPT_KEYS 60
+#endif
+#define BPT_MIN ((BPT_KEYS - 1) / 2)
+#define BPT_ALIGN 64
+#define BPT_MAX_HEIGHT 32
+
+#define BPT_INNER(X) ((bpt_inner_t *)(X))
+#define BPT_LEAF(X) ((bpt_leaf_t *)(X))
+
+/**
+ * struct bpt_node_s - Header and keys shared by every B+tree node
+ *
+ * Unused key slots hold INT_MAX, so searching a node is a fixed-length
+ * count of smaller keys that the compiler turns into SIMD compares.
+ *
+ * @count: Number of keys in use
+ * @leaf: 1 for a leaf, 0 for an inner node
+ * @keys: Sorted keys; in an inner node keys[i] bounds child[i] from above
+ */
+typedef struct bpt_node_s
+{
+	int count;
+	int leaf;
+	int keys[BPT_KEYS];
+} bpt_node_t;
+
+/**
+ * struct bpt_inner_s - Inner node of a B+tree
+ *
+ * Child i holds the values in (keys[i - 1], keys[i]]; the last child holds
+ * the values above keys[count - 1].
+ *
+ * @node: Header and separator keys
+ * @child: Pointers to the count + 1 children
+ */
+typedef struct bpt_inner_s
+{
+	bpt_node_t node;
+	bpt_node_t *child[BPT_KEYS + 1];
+} bpt_inner_t;
+
+/**
+ * struct bpt_leaf_s - Leaf of a B+tree
+ *
+ * @node: Header and values
+ * @next: Pointer to the next leaf in order, NULL for the last one
+ */
+typedef struct bpt_leaf_s
+{
+	bpt_node_t node;
+	bpt_node_t *next;
+} bpt_leaf_t;
+
+/**
+ * struct bpt_tree_s - B+tree set of integers, an alternative backend to
+ *                     rb_tree_t for sets much larger than the cache
+ *
+ * @root: Pointer to the root node, NULL if the tree is empty
+ * @height: Number of levels, 0 if the tree is empty
+ * @count: Number of values in the tree
+ */
+typedef struct bpt_tree_s
+{
+	bpt_node_t *root;
+	int height;
+	size_t count;
+} bpt_tree_t;
+
+/* bpt_tree.c */
+bpt_tree_t *bpt_tree_create(void);
+bpt_node_t *bpt_node_create(int leaf);
+void bpt_node_free(bpt_node_t *node);
+void bpt_tree_delete(bpt_tree_t *tree);
+int bpt_search(const bpt_node_t *node, int value);
+int bpt_tree_find(const bpt_tree_t *tree, int value);
+size_t bpt_tree_range(const bpt_tree_t *tree, int lo, int hi,
+		      void (*action)(int value, void *data), void *data);
+
+/* bpt_insert.c */
+int bpt_split_child(bpt_node_t *node, int i);
+int bpt_tree_insert(bpt_tree_t *tree, int value);
+
+/* bpt_remove.c */
+void bpt_borrow_left(bpt_node_t *node, int i);
+void bpt_borrow_right(bpt_node_t *node, int i);
+void bpt_merge(bpt_node_t *node, int i);
+int bpt_remove_rec(bpt_node_t *node, int value);
+int bpt_tree_remove(bpt_tree_t *tree, int value);
+
+/* bpt_is_valid.c */
+int bpt_tree_is_valid(const bpt_tree_t *tree);
+long bpt_check(const bpt_node_t *node, int depth, int height,
+	       const int *min, const int *max, const bpt_node_t **leaf);
+
+#endif /* __RB_BPTREE_H__ */
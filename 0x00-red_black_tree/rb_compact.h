@@ -0,0 +1,83 @@
+#ifndef __RB_COMPACT_H__
+#define __RB_COMPACT_H__
+
+#include <stdint.h>
+#include "rb_trees.h"
+
+#define RBC_NIL 0
+#define RBC_MAX_NODES 0x7fffffffu
+
+#define RBC_L(T, X) ((T)->nodes[X].left)
+#define RBC_R(T, X) ((T)->nodes[X].right)
+#define RBC_P(T, X) ((T)->nodes[X].link >> 1)
+#define RBC_COLOR(T, X) ((rb_color_t)((T)->nodes[X].link & 1))
+#define RBC_SET_P(T, X, P) \
+	((T)->nodes[X].link = ((uint32_t)(P) << 1) | ((T)->nodes[X].link & 1))
+#define RBC_SET_COLOR(T, X, C) \
+	((T)->nodes[X].link = ((T)->nodes[X].link & ~1u) | (uint32_t)(C))
+
+/**
+ * struct rbc_node_s - Links of a node of a compact Red-Black tree
+ *
+ * @left: Index of the left child, RBC_NIL if none
+ * @right: Index of the right child, RBC_NIL if none
+ * @link: Index of the parent shifted left by one, with the color (RED or
+ *        BLACK) in the lowest bit
+ */
+typedef struct rbc_node_s
+{
+	uint32_t left;
+	uint32_t right;
+	uint32_t link;
+} rbc_node_t;
+
+/**
+ * struct rbc_tree_s - Red-Black tree stored in contiguous arrays
+ *
+ * Slot 0 of @nodes is a black sentinel standing for every empty leaf, so
+ * a node costs 12 bytes of links plus 4 bytes of key.
+ *
+ * @nodes: Links of every node, indexed by node index
+ * @keys: Value of every node, indexed by node index
+ * @root: Index of the root node, RBC_NIL if the tree is empty
+ * @used: Number of slots handed out so far, sentinel included
+ * @capacity: Number of slots allocated in @nodes and @keys
+ * @free_list: Index of the first removed slot, chained through left
+ * @count: Number of values in the tree
+ */
+typedef struct rbc_tree_s
+{
+	rbc_node_t *nodes;
+	int *keys;
+	uint32_t root;
+	uint32_t used;
+	uint32_t capacity;
+	uint32_t free_list;
+	size_t count;
+} rbc_tree_t;
+
+/* rbc_tree.c */
+rbc_tree_t *rbc_tree_create(size_t capacity);
+void rbc_tree_delete(rbc_tree_t *tree);
+uint32_t rbc_tree_node(rbc_tree_t *tree, int value);
+void rbc_rotate_left(rbc_tree_t *tree, uint32_t x);
+void rbc_rotate_right(rbc_tree_t *tree, uint32_t y);
+
+/* rbc_tree_insert.c */
+uint32_t rbc_tree_find(const rbc_tree_t *tree, int value);
+uint32_t rbc_tree_insert(rbc_tree_t *tree, int value);
+void rbc_insert_fixup(rbc_tree_t *tree, uint32_t z);
+
+/* rbc_tree_remove.c */
+void rbc_transplant(rbc_tree_t *tree, uint32_t u, uint32_t v);
+int rbc_tree_remove(rbc_tree_t *tree, int value);
+void rbc_delete_fixup(rbc_tree_t *tree, uint32_t x);
+uint32_t rbc_delete_fix_left(rbc_tree_t *tree, uint32_t x);
+uint32_t rbc_delete_fix_right(rbc_tree_t *tree, uint32_t x);
+
+/* rbc_tree_is_valid.c */
+int rbc_tree_is_valid(const rbc_tree_t *tree);
+int rbc_check(const rbc_tree_t *tree, uint32_t x, const int *min,
+	      const int *max);
+
+#endif /* __RB_COMPACT_H__ */
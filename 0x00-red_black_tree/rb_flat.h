@@ -0,0 +1,69 @@
+#ifndef __RB_FLAT_H__
+#define __RB_FLAT_H__
+
+#include <stdint.h>
+#include "rb_trees.h"
+
+#define RB_FLAT_MAGIC "RBFLAT1"
+#define RB_FLAT_ORDER 0x01020304u
+#define RB_FLAT_VERSION 1
+#define RB_FLAT_RED(F, I) (((F)->colors[(I) >> 3] >> ((I) & 7)) & 1)
+
+/**
+ * struct rb_flat_header_s - Header of a flat Red-Black tree file
+ *
+ * The header is followed by @count int keys in Eytzinger order (the
+ * children of key i are keys 2i + 1 and 2i + 2), then by one color bit
+ * per key, set for red. Keys and header use the byte order of the machine
+ * that wrote the file.
+ *
+ * @magic: RB_FLAT_MAGIC, NUL terminated
+ * @order: RB_FLAT_ORDER, to detect a byte order mismatch
+ * @version: RB_FLAT_VERSION
+ * @count: Number of keys
+ * @pad: Zeroes, so the keys start on a cache line
+ */
+typedef struct rb_flat_header_s
+{
+	char magic[8];
+	uint32_t order;
+	uint32_t version;
+	uint64_t count;
+	unsigned char pad[40];
+} rb_flat_header_t;
+
+/**
+ * struct rb_flat_s - Read-only Red-Black tree mapped from a file
+ *
+ * @map: Start of the mapping
+ * @length: Length of the mapping
+ * @keys: Keys in Eytzinger order, inside the mapping
+ * @colors: Color bits, inside the mapping
+ * @count: Number of keys
+ */
+typedef struct rb_flat_s
+{
+	void *map;
+	size_t length;
+	const int *keys;
+	const unsigned char *colors;
+	size_t count;
+} rb_flat_t;
+
+/* rb_flat_save.c */
+size_t rb_flat_fill(int *keys, size_t count, size_t i, const rb_tree_t **cur);
+int rb_flat_save(const rb_tree_t *tree, const char *path);
+
+/* rb_flat_open.c */
+rb_flat_t *rb_flat_open(const char *path);
+void rb_flat_close(rb_flat_t *flat);
+int rb_flat_find(const rb_flat_t *flat, int value);
+size_t rb_flat_lower_bound(const rb_flat_t *flat, int value);
+size_t rb_flat_next(const rb_flat_t *flat, size_t i);
+
+/* rb_flat_to_rb_tree.c */
+rb_tree_t *rb_flat_node(const rb_flat_t *flat, size_t i, rb_tree_t *parent,
+			int *failed);
+rb_tree_t *rb_flat_to_rb_tree(const rb_flat_t *flat);
+
+#endif /* __RB_FLAT_H__ */
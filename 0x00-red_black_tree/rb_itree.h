@@ -0,0 +1,51 @@
+#ifndef __RB_ITREE_H__
+#define __RB_ITREE_H__
+
+#include "rb_trees.h"
+
+#define RB_ITREE(X) ((rb_itree_t *)(X))
+#define RB_ITREE_MAX(X) ((X) ? RB_ITREE(X)->max : INT_MIN)
+
+/**
+ * struct rb_itree_s - Node of an interval Red-Black tree
+ *
+ * Nodes are ordered by lower bound, then upper bound. Equal intervals are
+ * allowed and kept in insertion order.
+ *
+ * @node: Red-Black tree links, first so the node can be used as a
+ *        rb_tree_t by the fixup, rank and iteration functions; node.n is
+ *        the lower bound of the interval
+ * @hi: Upper bound of the interval, included
+ * @max: Largest upper bound in the subtree rooted at this node
+ * @value: Value stored with the interval
+ */
+typedef struct rb_itree_s
+{
+	rb_tree_t node;
+	int hi;
+	int max;
+	void *value;
+} rb_itree_t;
+
+/* rb_itree.c */
+void rb_itree_recompute(rb_tree_t *node);
+void rb_itree_update(rb_tree_t *node);
+rb_itree_t *rb_itree_insert(rb_tree_t **tree, int lo, int hi, void *value);
+void *rb_itree_remove(rb_tree_t **tree, rb_itree_t *interval);
+void rb_itree_delete(rb_tree_t *tree, void (*free_value)(void *value));
+
+/* rb_itree_query.c */
+rb_itree_t *rb_itree_find(const rb_tree_t *tree, int lo, int hi);
+size_t rb_itree_overlap(const rb_tree_t *tree, int lo, int hi,
+			void (*action)(const rb_itree_t *interval, void *data),
+			void *data);
+size_t rb_itree_stab(const rb_tree_t *tree, int x,
+		     void (*action)(const rb_itree_t *interval, void *data),
+		     void *data);
+
+/* rb_itree_is_valid.c */
+int rb_itree_is_valid(const rb_tree_t *tree);
+int rb_itree_check(const rb_tree_t *node, const rb_tree_t *min,
+		   const rb_tree_t *max);
+
+#endif /* __RB_ITREE_H__ */
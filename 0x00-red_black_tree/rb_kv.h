@@ -0,0 +1,89 @@
+#ifndef __RB_KV_H__
+#define __RB_KV_H__
+
+#include <stdint.h>
+#include "rb_trees.h"
+
+#define RB_KV(X) ((rb_kv_node_t *)(X))
+
+/**
+ * enum rb_key_type_e - Kind of keys stored in a key/value tree
+ *
+ * @RB_KEY_INT: int keys, compared inline and stored in node.n
+ * @RB_KEY_INT64: 64-bit keys, compared inline
+ * @RB_KEY_PTR: keys compared by the tree comparator
+ */
+typedef enum rb_key_type_e
+{
+	RB_KEY_INT = 0,
+	RB_KEY_INT64,
+	RB_KEY_PTR
+} rb_key_type_t;
+
+/**
+ * union rb_key_u - Key of a key/value tree node
+ *
+ * @i: int key
+ * @i64: 64-bit key
+ * @ptr: key handed to the comparator
+ */
+typedef union rb_key_u
+{
+	int i;
+	int64_t i64;
+	const void *ptr;
+} rb_key_t;
+
+/**
+ * struct rb_kv_node_s - Node of a key/value Red-Black tree
+ *
+ * @node: Red-Black tree links, first so the node can be used as a
+ *        rb_tree_t by the insert, remove and iteration functions
+ * @key: Key of the node
+ * @value: Value stored with the key
+ */
+typedef struct rb_kv_node_s
+{
+	rb_tree_t node;
+	rb_key_t key;
+	void *value;
+} rb_kv_node_t;
+
+/**
+ * struct rb_kv_tree_s - Key/value Red-Black tree
+ *
+ * @root: Pointer to the root node
+ * @type: Kind of keys stored in the tree
+ * @cmp: Comparator for RB_KEY_PTR keys, returns <0, 0 or >0 like strcmp
+ * @search: Search loop for @type, chosen once by rb_kv_create
+ */
+typedef struct rb_kv_tree_s
+{
+	rb_tree_t *root;
+	rb_key_type_t type;
+	int (*cmp)(const void *a, const void *b);
+	rb_tree_t **(*search)(struct rb_kv_tree_s *tree, rb_key_t key,
+			      rb_tree_t **parent);
+} rb_kv_tree_t;
+
+/* rb_kv_tree.c */
+rb_kv_tree_t *rb_kv_create(rb_key_type_t type,
+			   int (*cmp)(const void *a, const void *b));
+void rb_kv_free_nodes(rb_tree_t *tree, void (*free_value)(void *value));
+void rb_kv_delete(rb_kv_tree_t *tree, void (*free_value)(void *value));
+rb_tree_t **rb_kv_search_int(rb_kv_tree_t *tree, rb_key_t key,
+			     rb_tree_t **parent);
+rb_tree_t **rb_kv_search_int64(rb_kv_tree_t *tree, rb_key_t key,
+			       rb_tree_t **parent);
+rb_tree_t **rb_kv_search_ptr(rb_kv_tree_t *tree, rb_key_t key,
+			     rb_tree_t **parent);
+
+/* rb_kv_insert.c */
+rb_kv_node_t *rb_kv_insert(rb_kv_tree_t *tree, rb_key_t key, void *value);
+rb_kv_node_t *rb_kv_find(rb_kv_tree_t *tree, rb_key_t key);
+int rb_kv_remove(rb_kv_tree_t *tree, rb_key_t key, void **value);
+rb_key_t rb_key_int(int i);
+rb_key_t rb_key_int64(int64_t i64);
+rb_key_t rb_key_ptr(const void *ptr);
+
+#endif /* __RB_KV_H__ */
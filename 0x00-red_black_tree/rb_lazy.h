@@ -0,0 +1,51 @@
+#ifndef __RB_LAZY_H__
+#define __RB_LAZY_H__
+
+#include "rb_trees.h"
+
+#define RB_LAZY(X) ((rb_lazy_node_t *)(X))
+
+/**
+ * struct rb_lazy_node_s - Node of a Red-Black tree with lazy deletion
+ *
+ * @node: Red-Black tree links, first so the node can be used as a
+ *        rb_tree_t; node.size also counts dead nodes until compaction
+ * @dead: Set when the value was removed but the node is still linked
+ */
+typedef struct rb_lazy_node_s
+{
+	rb_tree_t node;
+	int dead;
+} rb_lazy_node_t;
+
+/**
+ * struct rb_lazy_s - Red-Black tree whose removals leave tombstones
+ *
+ * @root: Pointer to the root node
+ * @live: Number of values in the tree
+ * @dead: Number of tombstones
+ * @threshold: Fraction of tombstones among all nodes above which a removal
+ *             compacts the tree, 0 to only compact on request
+ */
+typedef struct rb_lazy_s
+{
+	rb_tree_t *root;
+	size_t live;
+	size_t dead;
+	double threshold;
+} rb_lazy_t;
+
+/* rb_lazy.c */
+rb_lazy_t *rb_lazy_create(double threshold);
+void rb_lazy_delete(rb_lazy_t *tree);
+rb_lazy_node_t *rb_lazy_insert(rb_lazy_t *tree, int value);
+int rb_lazy_remove(rb_lazy_t *tree, int value);
+const rb_tree_t *rb_lazy_find(const rb_lazy_t *tree, int value);
+
+/* rb_lazy_compact.c */
+const rb_tree_t *rb_lazy_first(const rb_lazy_t *tree);
+const rb_tree_t *rb_lazy_next(const rb_tree_t *node);
+rb_tree_t *rb_lazy_prune(rb_tree_t *list);
+int rb_lazy_compact(rb_lazy_t *tree);
+
+#endif /* __RB_LAZY_H__ */
@@ -0,0 +1,30 @@
+#ifndef __RB_MULTI_H__
+#define __RB_MULTI_H__
+
+#include "rb_trees.h"
+
+#define RB_MULTI(X) ((rb_multi_t *)(X))
+
+/**
+ * struct rb_multi_s - Node of a Red-Black multiset
+ *
+ * Nodes of a multiset must only be created and removed by the rb_multi_*
+ * functions; every other read-only rb_tree_t function works on them, and
+ * the whole tree can be released with rb_build_free.
+ *
+ * @node: Red-Black tree links, first so the node can be used as a
+ *        rb_tree_t; node.size counts distinct values
+ * @count: Number of occurrences of node.n, at least 1
+ */
+typedef struct rb_multi_s
+{
+	rb_tree_t node;
+	size_t count;
+} rb_multi_t;
+
+/* rb_multi.c */
+rb_multi_t *rb_multi_insert(rb_tree_t **tree, int value);
+rb_tree_t *rb_multi_remove(rb_tree_t *root, int value);
+size_t rb_multi_count(const rb_tree_t *tree, int value);
+
+#endif /* __RB_MULTI_H__ */
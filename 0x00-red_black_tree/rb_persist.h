@@ -0,0 +1,83 @@
+#ifndef __RB_PERSIST_H__
+#define __RB_PERSIST_H__
+
+#include "rb_trees.h"
+
+/* Height of a Red-Black tree is at most 2 * log2(n + 1) */
+#define RBP_MAX_DEPTH 130
+#define RBP_MAX_FRESH (4 * RBP_MAX_DEPTH)
+
+/**
+ * struct rbp_node_s - Node of a persistent Red-Black tree
+ *
+ * Nodes are shared between versions, so they have no parent pointer and
+ * are never modified once an operation has returned.
+ *
+ * @n: Integer stored in the node
+ * @color: Color of the node (RED or BLACK)
+ * @ref: Number of nodes and versions pointing to this node, updated
+ *       atomically
+ * @fresh: Set while the node is private to the running operation
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct rbp_node_s
+{
+	int n;
+	rb_color_t color;
+	unsigned int ref;
+	unsigned int fresh;
+	struct rbp_node_s *left;
+	struct rbp_node_s *right;
+} rbp_node_t;
+
+/**
+ * struct rbp_op_s - State of an insertion or removal building a version
+ *
+ * @root: Root of the version being built
+ * @path: Private nodes from @root down to the current node
+ * @depth: Number of nodes in @path
+ * @fresh: Every node copied or created by the operation
+ * @nb_fresh: Number of nodes in @fresh
+ * @failed: Set when an allocation failed
+ */
+typedef struct rbp_op_s
+{
+	rbp_node_t *root;
+	rbp_node_t *path[RBP_MAX_DEPTH];
+	size_t depth;
+	rbp_node_t *fresh[RBP_MAX_FRESH];
+	size_t nb_fresh;
+	int failed;
+} rbp_op_t;
+
+/* rbp_tree.c */
+rbp_node_t *rbp_retain(rbp_node_t *root);
+void rbp_release(rbp_node_t *root);
+const rbp_node_t *rbp_find(const rbp_node_t *root, int value);
+rbp_node_t *rbp_own(rbp_op_t *op, rbp_node_t **link);
+rbp_node_t **rbp_link(rbp_op_t *op, size_t i);
+
+/* rbp_op.c */
+void rbp_op_init(rbp_op_t *op, rbp_node_t *root);
+int rbp_op_finish(rbp_op_t *op, rbp_node_t **version);
+rbp_node_t *rbp_node(rbp_op_t *op, int value);
+void rbp_rotate_left(rbp_node_t **link);
+void rbp_rotate_right(rbp_node_t **link);
+
+/* rbp_insert.c */
+int rbp_insert(rbp_node_t *root, int value, rbp_node_t **version);
+void rbp_insert_fixup(rbp_op_t *op);
+
+/* rbp_remove.c */
+int rbp_remove(rbp_node_t *root, int value, rbp_node_t **version);
+void rbp_unlink(rbp_op_t *op);
+void rbp_delete_fixup(rbp_op_t *op, int left);
+int rbp_delete_fix_left(rbp_op_t *op);
+int rbp_delete_fix_right(rbp_op_t *op);
+
+/* rbp_is_valid.c */
+int rbp_is_valid(const rbp_node_t *root);
+int rbp_check(const rbp_node_t *node, const int *min, const int *max);
+
+#endif /* __RB_PERSIST_H__ */
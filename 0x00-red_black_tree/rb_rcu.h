@@ -0,0 +1,88 @@
+#ifndef __RB_RCU_H__
+#define __RB_RCU_H__
+
+#include <pthread.h>
+#include "rb_persist.h"
+
+#define RB_RCU_MAX_READERS 64
+#define RB_RCU_CACHE_LINE 64
+#define RB_RCU_PAD(USED) (RB_RCU_CACHE_LINE - (USED) % RB_RCU_CACHE_LINE)
+
+/**
+ * struct rb_rcu_reader_s - Reader slot, alone on its cache line
+ *
+ * @active: Epoch the reader entered its critical section in, 0 outside
+ * @in_use: Set while the slot is registered to a reader thread
+ * @pad: Keeps two slots off the same cache line
+ */
+typedef struct rb_rcu_reader_s
+{
+	unsigned long active;
+	int in_use;
+	char pad[RB_RCU_PAD(sizeof(unsigned long) + sizeof(int))];
+} rb_rcu_reader_t;
+
+/**
+ * struct rb_rcu_retired_s - Version waiting for its readers to leave
+ *
+ * @version: Root of the replaced version
+ * @epoch: Epoch the version was replaced in
+ * @next: Pointer to the next retired version
+ */
+typedef struct rb_rcu_retired_s
+{
+	rbp_node_t *version;
+	unsigned long epoch;
+	struct rb_rcu_retired_s *next;
+} rb_rcu_retired_t;
+
+/**
+ * struct rb_rcu_s - Red-Black tree with lock-free readers and one writer
+ *
+ * Writers build a new persistent version and publish its root with an
+ * atomic store. Readers only load the root, so they never block and
+ * always see a complete, immutable tree. A replaced version is released
+ * once every reader that could still hold it has left.
+ *
+ * The tree is allocated on a cache line boundary and @pad pushes @readers
+ * to the next one, so every reader slot fills whole lines of its own.
+ *
+ * @root: Root of the published version
+ * @epoch: Global epoch, bumped after each publication, starts at 1
+ * @pad: Keeps the reader slots off the line of @root and @epoch
+ * @readers: Reader slots
+ * @retired: Replaced versions, newest first
+ * @lock: Serializes writers
+ */
+typedef struct rb_rcu_s
+{
+	rbp_node_t *root;
+	unsigned long epoch;
+	char pad[RB_RCU_PAD(sizeof(rbp_node_t *) + sizeof(unsigned long))];
+	rb_rcu_reader_t readers[RB_RCU_MAX_READERS];
+	rb_rcu_retired_t *retired;
+	pthread_mutex_t lock;
+} rb_rcu_t;
+
+/* rb_rcu.c */
+rb_rcu_t *rb_rcu_create(void);
+void rb_rcu_destroy(rb_rcu_t *rcu);
+int rb_rcu_register(rb_rcu_t *rcu);
+void rb_rcu_unregister(rb_rcu_t *rcu, int reader);
+
+/* rb_rcu_read.c */
+const rbp_node_t *rb_rcu_read_lock(rb_rcu_t *rcu, int reader);
+void rb_rcu_read_unlock(rb_rcu_t *rcu, int reader);
+int rb_rcu_find(rb_rcu_t *rcu, int reader, int value);
+size_t rbp_range(const rbp_node_t *root, int lo, int hi,
+		 void (*action)(const rbp_node_t *node, void *data),
+		 void *data);
+
+/* rb_rcu_write.c */
+int rb_rcu_quiescent(rb_rcu_t *rcu, unsigned long epoch);
+void rb_rcu_reclaim(rb_rcu_t *rcu);
+void rb_rcu_publish(rb_rcu_t *rcu, rbp_node_t *version);
+int rb_rcu_insert(rb_rcu_t *rcu, int value);
+int rb_rcu_remove(rb_rcu_t *rcu, int value);
+
+#endif /* __RB_RCU_H__ */
@@ -0,0 +1,44 @@
+#include <pthread.h>
+#include "rb_trees.h"
+
+/**
+ * rb_setop_run - runs one half of a set operation
+ *
+ * @arg: pointer to the rb_setop_t describing the half
+ *
+ * Return: @arg
+ */
+void *rb_setop_run(void *arg)
+{
+	rb_setop_t *half = arg;
+
+	half->result = half->op(half->a, half->b, half->depth);
+	return (arg);
+}
+
+/**
+ * rb_setop_fork - runs both halves of a set operation, in parallel when
+ *                 they are large enough
+ *
+ * The halves work on disjoint subtrees. A thread is spawned for @lo only
+ * while the inputs hold at least RB_SET_GRAIN nodes and the recursion has
+ * not yet fanned out to RB_SET_THREADS threads.
+ *
+ * @lo: half working on the smaller values
+ * @hi: half working on the larger values
+ * @total: number of nodes in both inputs of the operation
+ */
+void rb_setop_fork(rb_setop_t *lo, rb_setop_t *hi, size_t total)
+{
+	pthread_t thread;
+
+	if (total >= RB_SET_GRAIN && (1 << lo->depth) <= RB_SET_THREADS &&
+	    pthread_create(&thread, NULL, rb_setop_run, lo) == 0)
+	{
+		rb_setop_run(hi);
+		pthread_join(thread, NULL);
+		return;
+	}
+	rb_setop_run(lo);
+	rb_setop_run(hi);
+}
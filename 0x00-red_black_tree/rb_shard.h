@@ -0,0 +1,72 @@
+#ifndef __RB_SHARD_H__
+#define __RB_SHARD_H__
+
+#include <pthread.h>
+#include <stdint.h>
+#include "rb_trees.h"
+
+#define RB_SHARD_CACHE_LINE 64
+#define RB_SHARD_USED (sizeof(pthread_mutex_t) + sizeof(rb_tree_t *))
+#define RB_SHARD_PAD (RB_SHARD_CACHE_LINE - RB_SHARD_USED % RB_SHARD_CACHE_LINE)
+#ifndef RB_SHARD_SKEW
+#define RB_SHARD_SKEW 2
+#endif
+#ifndef RB_SHARD_SLACK
+#define RB_SHARD_SLACK 1024
+#endif
+
+/**
+ * struct rb_shard_s - One key range of a sharded tree, alone on its line
+ *
+ * @lock: Protects @root
+ * @root: Pointer to root node of the shard's tree
+ * @pad: Rounds the shard up to whole cache lines, so that in an array
+ *       aligned on a line no two shards share one
+ */
+typedef struct rb_shard_s
+{
+	pthread_mutex_t lock;
+	rb_tree_t *root;
+	char pad[RB_SHARD_PAD];
+} rb_shard_t;
+
+/**
+ * struct rb_shards_s - Red-Black trees range-partitioned by key
+ *
+ * Shard i holds the values in [lower[i], lower[i + 1]), so writers to
+ * different ranges never share a lock. The boundaries only move while
+ * every shard lock is held; an operation reads them without locking,
+ * locks the shard they point to, then checks the value still belongs
+ * there.
+ *
+ * @shards: Shards, by increasing key range, aligned on a cache line
+ * @lower: Smallest value of each shard, lower[0] is INT_MIN
+ * @count: Number of shards
+ * @limit: Size above which an insertion rebalances the boundaries
+ */
+typedef struct rb_shards_s
+{
+	rb_shard_t *shards;
+	int *lower;
+	size_t count;
+	size_t limit;
+} rb_shards_t;
+
+/* rb_shards.c */
+rb_shards_t *rb_shards_create(size_t count, int lo, int hi);
+void rb_shards_destroy(rb_shards_t *tree);
+size_t rb_shards_lock(rb_shards_t *tree, int value);
+int rb_shards_insert(rb_shards_t *tree, int value);
+int rb_shards_remove(rb_shards_t *tree, int value);
+int rb_shards_find(rb_shards_t *tree, int value);
+
+/* rb_shards_rebalance.c */
+void rb_shards_bound(rb_shards_t *tree, size_t i, int lower);
+int rb_shards_rebalance(rb_shards_t *tree, int force);
+
+/* rb_shards_range.c */
+size_t rb_shards_range(rb_shards_t *tree, int lo, int hi,
+		       void (*action)(const rb_tree_t *node, void *data),
+		       void *data);
+
+#endif /* __RB_SHARD_H__ */
@@ -5,7 +5,35 @@
 #include <stdlib.h>
 #include <limits.h>
 
+#define RB_ARENA_SLAB 1024
+#ifndef RB_SET_THREADS
+#define RB_SET_THREADS 8
+#endif
+#ifndef RB_SET_GRAIN
+#define RB_SET_GRAIN 65536
+#endif
+#ifndef RB_FIND_GROUP
+#define RB_FIND_GROUP 16
+#endif
 #define MAXIMUM(X, Y) ((X >= Y) ? X : Y)
+#define IS_BLACK(X) ((X) == NULL || (X)->color == BLACK)
+#define RB_SIZE(X) ((X) ? (X)->size : 0)
+
+/* Build with -DRB_STATS to count the work of insert and remove */
+#ifdef RB_STATS
+#define RB_STAT(FIELD, N) (rb_stats.FIELD += (N))
+#define RB_STAT_DEPTH(D) \
+	(++(D) > rb_stats.max_depth ? (void)(rb_stats.max_depth = (D)) : (void)0)
+#define RB_STAT_WALK(X) rb_stats_walk(X)
+#define RB_RECOLOR(X, C) \
+	((X)->color != (C) ? (void)(rb_stats.recolors++, (X)->color = (C)) \
+	 : (void)0)
+#else
+#define RB_STAT(FIELD, N) ((void)0)
+#define RB_STAT_DEPTH(D) ((void)sizeof(D))
+#define RB_STAT_WALK(X) ((void)0)
+#define RB_RECOLOR(X, C) ((void)((X)->color = (C)))
+#endif
 
 #define BLK "\033[0;30m"
 #define ARED "\033[0;31m"
@@ -39,6 +67,7 @@ typedef enum rb_color_e
  * @left: Pointer to the left child node
  * @right: Pointer to the right child node
  * @color: Color of the node (RED or BLACK)
+ * @size: Number of nodes in the subtree rooted at this node
  */
 typedef struct rb_tree_s
 {
@@ -47,8 +76,106 @@ typedef struct rb_tree_s
 	struct rb_tree_s *parent;
 	struct rb_tree_s *left;
 	struct rb_tree_s *right;
+	size_t size;
 } rb_tree_t;
 
+/**
+ * struct rb_build_s - State of a linear-time build from a sorted array
+ *
+ * @array: sorted values
+ * @size: number of values in @array
+ * @i: index of the next value to consume
+ * @list: existing nodes to relink, linked through their right pointers,
+ *        or NULL to use @array
+ * @block: preallocated nodes, or NULL to allocate them one by one
+ * @slot: index of the next unused node in @block
+ * @red_depth: depth of the last, partial level, whose nodes are red
+ * @failed: set when a node allocation fails
+ */
+typedef struct rb_build_s
+{
+	const int *array;
+	size_t size;
+	size_t i;
+	rb_tree_t *list;
+	rb_tree_t *block;
+	size_t slot;
+	size_t red_depth;
+	int failed;
+} rb_build_t;
+
+/**
+ * struct rb_slab_s - Contiguous block of Red-Black tree nodes
+ *
+ * @nodes: Nodes of the slab, stored right after this header
+ * @used: Number of nodes already handed out
+ * @next: Pointer to the previously allocated slab
+ */
+typedef struct rb_slab_s
+{
+	rb_tree_t *nodes;
+	size_t used;
+	struct rb_slab_s *next;
+} rb_slab_t;
+
+/**
+ * struct rb_arena_s - Node pool backing one or more Red-Black trees
+ *
+ * @slabs: Pointer to the most recently allocated slab
+ * @free_list: Removed nodes waiting for reuse, chained through parent
+ * @slab_size: Number of nodes per slab
+ */
+typedef struct rb_arena_s
+{
+	rb_slab_t *slabs;
+	rb_tree_t *free_list;
+	size_t slab_size;
+} rb_arena_t;
+
+/**
+ * struct rb_setop_s - One half of a recursive set operation
+ *
+ * @op: Recursive operation to run
+ * @a: First operand
+ * @b: Second operand
+ * @depth: Recursion depth of the half
+ * @result: Root of the resulting tree, set once the half has run
+ */
+typedef struct rb_setop_s
+{
+	rb_tree_t *(*op)(rb_tree_t *a, rb_tree_t *b, int depth);
+	rb_tree_t *a;
+	rb_tree_t *b;
+	int depth;
+	rb_tree_t *result;
+} rb_setop_t;
+
+/**
+ * struct rb_stats_s - Work done by the insert and remove functions
+ *
+ * Only collected when built with -DRB_STATS, per thread.
+ *
+ * @comparisons: Nodes compared against a value while searching
+ * @rotations: Calls to rb_rotate_left and rb_rotate_right
+ * @recolors: Nodes whose color the fixups actually changed
+ * @fixups: Iterations of the insert and delete fixup loops
+ * @max_depth: Deepest node reached by a search or by the successor walk
+ *             of a removal, the root being at depth 1
+ */
+typedef struct rb_stats_s
+{
+	size_t comparisons;
+	size_t rotations;
+	size_t recolors;
+	size_t fixups;
+	size_t max_depth;
+} rb_stats_t;
+
+#ifdef RB_STATS
+extern __thread rb_stats_t rb_stats;
+void rb_stats_walk(const rb_tree_t *node);
+#endif
+
 void rb_tree_print(const rb_tree_t *tree);
 
 /* rb_tree_node.c */
@@ -56,18 +183,18 @@ rb_tree_t *rb_tree_node(rb_tree_t *parent, int value, rb_color_t color);
 
 /* rb_tree_is_valid.c */
 int rb_tree_is_valid(const rb_tree_t *tree);
-int is_bst(const rb_tree_t *tree, int min, int max);
-int correct_colors(const rb_tree_t *tree);
-int find_height(const rb_tree_t *tree);
-int check_rb_height(const rb_tree_t *tree, int blk_height, int height);
+int rb_valid_enter(const rb_tree_t *node, int *depth);
+int rb_valid_leaf(int depth, int *black);
 
 /* rb_tree_insert.c */
 rb_tree_t *rb_tree_insert(rb_tree_t **tree, int value);
+rb_tree_t **rb_tree_slot(rb_tree_t **tree, int value, rb_tree_t **parent);
 void rb_insert_fixup(rb_tree_t **tree, rb_tree_t *new);
 rb_tree_t *rb_insert_fixup_LEFT(rb_tree_t **tree, rb_tree_t *new);
 rb_tree_t *rb_insert_fixup_RIGHT(rb_tree_t **tree, rb_tree_t *new);
 void rb_rotate_left(rb_tree_t **tree, rb_tree_t *new);
 void rb_rotate_right(rb_tree_t **tree, rb_tree_t *new);
+void rb_tree_resize(rb_tree_t *node, long delta);
 
 /* array_to_rb_tree.c */
 rb_tree_t *array_to_rb_tree(int *array, size_t size);
@@ -76,9 +203,90 @@ rb_tree_t *array_to_rb_tree(int *array, size_t size);
 rb_tree_t *rb_tree_remove(rb_tree_t *root, int n);
 rb_tree_t *rb_tree_delete(rb_tree_t *root, rb_tree_t *remove);
 void rb_transplant(rb_tree_t **root, rb_tree_t *x, rb_tree_t *y);
-rb_tree_t *rb_delete_fixup(rb_tree_t *root, rb_tree_t *x);
-rb_tree_t *rb_delete_fix_left(rb_tree_t **root, rb_tree_t *x);
-rb_tree_t *rb_delete_fix_right(rb_tree_t **root, rb_tree_t *x);
+rb_tree_t *rb_delete_fixup(rb_tree_t *root, rb_tree_t *x, rb_tree_t *parent);
+rb_tree_t *rb_delete_fix_left(rb_tree_t **root, rb_tree_t **parent);
+rb_tree_t *rb_delete_fix_right(rb_tree_t **root, rb_tree_t **parent);
 rb_tree_t *tree_min(rb_tree_t *root);
 
+/* sorted_array_to_rb_tree.c */
+size_t sorted_unique_count(const int *array, size_t size);
+size_t rb_red_depth(size_t count);
+rb_tree_t *rb_build_take(rb_build_t *b, size_t slot);
+rb_tree_t *rb_build_sorted(rb_build_t *b, size_t count, size_t depth);
+void rb_build_init(rb_build_t *b, size_t count);
+rb_tree_t *rb_tree_vine(rb_tree_t *tree, size_t *count);
+void rb_build_free(rb_tree_t *tree);
+rb_tree_t *rb_build_tree(const int *array, size_t size, size_t count,
+			 rb_tree_t *block);
+rb_tree_t *rb_build_vine(rb_tree_t *list, size_t count);
+rb_tree_t *sorted_array_to_rb_tree(int *array, size_t size);
+
+/* rb_arena.c */
+rb_arena_t *rb_arena_create(size_t slab_size);
+rb_slab_t *rb_arena_grow(rb_arena_t *arena);
+rb_tree_t *rb_arena_node(rb_arena_t *arena, rb_tree_t *parent, int value,
+			 rb_color_t color);
+void rb_arena_release(rb_arena_t *arena, rb_tree_t *node);
+void rb_arena_destroy(rb_arena_t *arena);
+
+/* rb_arena_tree.c */
+rb_tree_t *rb_arena_insert(rb_arena_t *arena, rb_tree_t **tree, int value);
+rb_tree_t *rb_arena_remove(rb_arena_t *arena, rb_tree_t *root, int n);
+
+/* rb_tree_order_stat.c */
+const rb_tree_t *rb_tree_select(const rb_tree_t *tree, size_t k);
+size_t rb_tree_rank(const rb_tree_t *tree, int n);
+
+/* rb_tree_iter.c */
+const rb_tree_t *rb_tree_first(const rb_tree_t *tree);
+const rb_tree_t *rb_tree_last(const rb_tree_t *tree);
+const rb_tree_t *rb_tree_next(const rb_tree_t *node);
+const rb_tree_t *rb_tree_prev(const rb_tree_t *node);
+
+/* rb_tree_range.c */
+const rb_tree_t *rb_tree_find(const rb_tree_t *tree, int n);
+const rb_tree_t *rb_tree_lower_bound(const rb_tree_t *tree, int n);
+const rb_tree_t *rb_tree_upper_bound(const rb_tree_t *tree, int n);
+size_t rb_tree_range(const rb_tree_t *tree, int lo, int hi,
+		     void (*action)(const rb_tree_t *node, void *data),
+		     void *data);
+
+/* rb_tree_find_batch.c */
+size_t rb_tree_find_batch(const rb_tree_t *tree, const int *keys, size_t n,
+			  const rb_tree_t **out);
+
+/* rb_tree_stats.c */
+int rb_stats_get(rb_stats_t *stats);
+void rb_stats_reset(void);
+
+/* rb_tree_join.c */
+int rb_black_height(const rb_tree_t *tree);
+rb_tree_t *rb_join_right(rb_tree_t *tree, rb_tree_t *key, rb_tree_t *right,
+			 int height, int target);
+rb_tree_t *rb_join_left(rb_tree_t *left, rb_tree_t *key, rb_tree_t *tree,
+			int height, int target);
+rb_tree_t *rb_tree_join(rb_tree_t *left, rb_tree_t *key, rb_tree_t *right);
+rb_tree_t *rb_tree_join2(rb_tree_t *left, rb_tree_t *right);
+
+/* rb_tree_split.c */
+void rb_tree_detach(rb_tree_t *node, rb_tree_t **left, rb_tree_t **right);
+rb_tree_t *rb_tree_split(rb_tree_t *tree, int n, rb_tree_t **left,
+			 rb_tree_t **right);
+
+/* rb_tree_set_ops.c */
+rb_tree_t *rb_union_rec(rb_tree_t *a, rb_tree_t *b, int depth);
+rb_tree_t *rb_intersection_rec(rb_tree_t *a, rb_tree_t *b, int depth);
+rb_tree_t *rb_difference_rec(rb_tree_t *a, rb_tree_t *b, int depth);
+rb_tree_t *rb_tree_union(rb_tree_t *a, rb_tree_t *b);
+rb_tree_t *rb_tree_intersection(rb_tree_t *a, rb_tree_t *b);
+rb_tree_t *rb_tree_difference(rb_tree_t *a, rb_tree_t *b);
+
+/* rb_tree_merge.c */
+rb_tree_t *rb_vine_merge(rb_tree_t *a, rb_tree_t *b, size_t *count);
+rb_tree_t *rb_tree_merge(rb_tree_t *a, rb_tree_t *b);
+
+/* rb_setop.c */
+void *rb_setop_run(void *arg);
+void rb_setop_fork(rb_setop_t *lo, rb_setop_t *hi, size_t total);
+
 #endif /*__RB_TREES_H__ */
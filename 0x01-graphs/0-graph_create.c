@@ -14,6 +14,10 @@ graph_t *graph_create(void)
 
 	newgraph->nb_vertices = 0;
 	newgraph->vertices = NULL;
+	newgraph->by_index = NULL;
+	newgraph->capacity = 0;
+	newgraph->table = NULL;
+	newgraph->table_size = 0;
 
 	return (newgraph);
 }
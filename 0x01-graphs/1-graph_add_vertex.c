@@ -16,7 +16,15 @@ vertex_t *graph_create_vertex(const char *str)
 		return (NULL);
 	v->index = 0;
 	v->content = strdup(str);
+	if (v->content == NULL)
+	{
+		free(v);
+		return (NULL);
+	}
 	v->edges = NULL;
+	v->last = NULL;
+	v->adjacent = NULL;
+	v->adjacent_size = 0;
 	v->nb_edges = 0;
 	v->next = NULL;
 	return (v);
@@ -24,6 +32,8 @@ vertex_t *graph_create_vertex(const char *str)
 
 /**
  * graph_add_vertex - A function that adds a vertex to an existing graph
+ * The hash index finds duplicates and the index array appends, both in
+ * constant time
  *
  * @graph: A pointer to the graph to add the vertex to
  * @str: The string to store in the new vertex
@@ -31,34 +41,29 @@ vertex_t *graph_create_vertex(const char *str)
  */
 vertex_t *graph_add_vertex(graph_t *graph, const char *str)
 {
-	vertex_t *new_vertix, *node, *prev;
-	size_t count = 0;
+	vertex_t *new_vertix;
 
 	if (graph == NULL || str == NULL)
 		return (NULL);
 
-	node = graph->vertices;
-	while (node != NULL)
-	{
-		if (strcmp(node->content, str) == 0)
-		{
-			return (NULL);
-		}
-		prev = node;
-		node = node->next;
-		count++;
-	}
+	if (graph_index_find(graph, str) != NULL)
+		return (NULL);
 	new_vertix = graph_create_vertex(str);
 	if (new_vertix == NULL)
 		return (NULL);
+	if (!graph_index_append(graph, new_vertix) ||
+	    !graph_index_add(graph, new_vertix))
+	{
+		free(new_vertix->content);
+		free(new_vertix);
+		return (NULL);
+	}
 	if (graph->nb_vertices == 0)
-
 		graph->vertices = new_vertix;
 	else
+		graph->by_index[graph->nb_vertices - 1]->next = new_vertix;
 
-		prev->next = new_vertix;
-
-	new_vertix->index = count;
+	new_vertix->index = graph->nb_vertices;
 	graph->nb_vertices += 1;
 
 	return (new_vertix);
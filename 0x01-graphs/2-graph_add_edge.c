@@ -1,7 +1,8 @@
 #include "graphs.h"
 
 /**
- * get_vertex - A function that fetches an vertex existing in graph
+ * get_vertex - A function that fetches an vertex existing in graph through
+ * its hash index
  * @graph: A pointer to the graph
  * @str: The string identifying the vertex
  *
@@ -9,26 +10,15 @@
  */
 vertex_t *get_vertex(graph_t *graph, const char *str)
 {
-	vertex_t *node;
-
 	if (str == NULL)
 		return (FAILURE);
-	node = graph->vertices;
-	if (node == NULL)
-		return (NULL);
-	while (node != NULL)
-	{
-		if (strcmp(node->content, str) == 0)
-		{
-			return (node);
-		}
-		node = node->next;
-	}
-	return (NULL);
+	return (graph_index_find(graph, str));
 }
 
 /**
  * create_edge -  A function that creates an edge between two vertices
+ * The edge is appended through the tail pointer, and recorded in the hash
+ * set of destinations once @src has enough edges to need one
  * @src: The src vertex to make the connection from
  * @dest: The destination vertex to connect to
  *
@@ -36,27 +26,25 @@ vertex_t *get_vertex(graph_t *graph, const char *str)
  */
 int create_edge(vertex_t *src, vertex_t *dest)
 {
-	edge_t *edge, *new_edge = NULL;
-
-	edge = src->edges;
-	while (edge && edge->next != NULL)
-	{
-		edge = edge->next;
-	}
+	edge_t *new_edge = NULL;
 
 	new_edge = malloc(sizeof(edge_t));
-	if (new_edge != NULL)
+	if (new_edge == NULL)
+		return (FAILURE);
+	if (src->nb_edges + 1 > GRAPH_EDGE_HASH && !edge_index_add(src, dest))
 	{
-		new_edge->dest = dest;
-		new_edge->next = NULL;
-
-		if (src->nb_edges == 0)
-			src->edges = new_edge;
-		else
-			edge->next = new_edge;
-		return (SUCCESS);
+		free(new_edge);
+		return (FAILURE);
 	}
-	return (FAILURE);
+	new_edge->dest = dest;
+	new_edge->next = NULL;
+
+	if (src->nb_edges == 0)
+		src->edges = new_edge;
+	else
+		src->last->next = new_edge;
+	src->last = new_edge;
+	return (SUCCESS);
 }
 
 /**
@@ -70,6 +58,8 @@ int edge_exists(vertex_t *src, vertex_t *dest)
 {
 	edge_t *edge = NULL;
 
+	if (src->adjacent != NULL)
+		return (edge_index_find(src, dest));
 	edge = src->edges;
 	while (edge != NULL)
 	{
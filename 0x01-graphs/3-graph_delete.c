@@ -21,10 +21,13 @@ void graph_delete(graph_t *graph)
 		}
 		t_vertex = graph->vertices;
 		graph->vertices = graph->vertices->next;
+		free(t_vertex->adjacent);
 		free(t_vertex->content);
 		free(t_vertex);
 		graph->nb_vertices -= 1;
 	}
+	free(graph->table);
+	free(graph->by_index);
 	free(graph);
 	graph = NULL;
 }
@@ -1,90 +1,83 @@
 #include "graphs.h"
 
 /**
- * createqueue_t - A function that creates a queue
- * Return: queue created
- */
-queue_t *createqueue_t()
-{
-	queue_t *q = malloc(sizeof(queue_t));
-
-	q->front = -1;
-	q->rear = -1;
-	return (q);
-}
-
-/**
- * enqueue - A function that appends the item in queue
+ * enqueue - A function that appends the item in queue, doubling the queue
+ * when it is full
  * @q: queue
  * @value: value to be stored
+ * Return: 1 on success, 0 on failure
  */
-void enqueue(queue_t *q, int value)
+int enqueue(queue_t *q, size_t value)
 {
-	if (q->rear == (SIZE - 1))
-		printf("\nqueue_t is Full!!");
-	else
+	size_t size = q->size ? q->size * 2 : GRAPH_INDEX_MIN, i, *items;
+
+	if (q->count == q->size)
 	{
-		if (q->front == -1)
-			q->front = 0;
-		q->rear++;
-		q->items[q->rear] = value;
+		items = malloc(size * sizeof(size_t));
+		if (items == NULL)
+			return (FAILURE);
+		for (i = 0; i < q->count; i++)
+			items[i] = q->items[(q->front + i) & (q->size - 1)];
+		free(q->items);
+		q->items = items;
+		q->size = size;
+		q->front = 0;
 	}
+	q->items[(q->front + q->count) & (q->size - 1)] = value;
+	q->count++;
+	return (SUCCESS);
 }
 
 /**
  * dequeue - A function that fetches first item in queue
- * @q: queue
- * @peek: whether to perform dequeue or just a peek
- * Return: first item in queue on success,  -1 on failure
+ * @q: queue, not empty
+ * Return: first item in queue
  */
-int dequeue(queue_t *q, int peek)
+size_t dequeue(queue_t *q)
 {
-	int item;
+	size_t item = q->items[q->front];
 
-	if (q->rear == -1)
-	{
-		printf("queue_t is empty");
-		item = -1;
-	} else
-	{
-		if (peek)
-			return (q->items[q->front]);
-		item = q->items[q->front];
-		q->front++;
-		if (q->front > q->rear)
-		{
-			q->front = q->rear = -1;
-		}
-	}
+	q->front = (q->front + 1) & (q->size - 1);
+	q->count--;
 	return (item);
 }
 
 /**
- * get_vertex_index - A function that fetches an vertex existing in graph by
- * index
- * @graph: A pointer to the graph
- * @index: The index identifying the vertex
- *
- * Return: vertex on success,  NULL on failure
+ * bfs_level - A function that visits one level of a breadth-first
+ * traversal
+ * The queue holds the frontier of the level; the vertices it discovers are
+ * queued behind it and form the next frontier
+ * @graph: A pointer to the graph to traverse
+ * @queue: queue holding the frontier
+ * @visited: array of nodes marked visited, queued or not
+ * @breadth: depth of the level
+ * @action: A  pointer to a function to be called for each visited vertex.
+ * Return: 1 on success, 0 on failure
  */
-vertex_t *get_vertex_index(const graph_t *graph, size_t index)
+int bfs_level(const graph_t *graph, queue_t *queue, size_t *visited,
+	      size_t breadth, void (*action)(const vertex_t *v, size_t breadth))
 {
-	vertex_t *node;
+	size_t level = queue->count;
+	vertex_t *curr, *dest;
+	edge_t *edge;
 
-	if (index > graph->nb_vertices)
-		return (NULL);
-	node = graph->vertices;
-	if (node == NULL)
-		return (NULL);
-	while (node != NULL)
+	while (level-- > 0)
 	{
-		if (node->index == index)
+		curr = get_vertex_index(graph, dequeue(queue));
+		visited[curr->index] = EXPLORED;
+		action(curr, breadth);
+		for (edge = curr->edges; edge; edge = edge->next)
 		{
-			return (node);
+			dest = edge->dest;
+			if (dest && visited[dest->index] == UNEXPLORED)
+			{
+				if (!enqueue(queue, dest->index))
+					return (FAILURE);
+				visited[dest->index] = BACKTRACK;
+			}
 		}
-		node = node->next;
 	}
-	return (NULL);
+	return (SUCCESS);
 }
 
 /**
@@ -97,42 +90,28 @@ vertex_t *get_vertex_index(const graph_t *graph, size_t index)
 size_t breadth_first_traverse(const graph_t *graph,
 			      void (*action)(const vertex_t *v, size_t breadth))
 {
-	size_t breadth = 0, *visited;
-	int index = 0;
-	vertex_t *curr, *dest;
-	edge_t *edge;
-	queue_t *q;
+	queue_t queue = {NULL, 0, 0, 0};
+	size_t breadth, *visited;
 
 	if (graph == NULL || graph->nb_vertices == 0 || graph->vertices == NULL)
 		return (0);
-	visited = calloc(graph->nb_vertices, sizeof(size_t)), q = createqueue_t();
-	curr = graph->vertices, enqueue(q, curr->index), enqueue(q, LEVELBREAK);
-	while (q->rear != -1)
+	visited = calloc(graph->nb_vertices, sizeof(size_t));
+	if (visited == NULL || !enqueue(&queue, graph->vertices->index))
 	{
-		index = dequeue(q, 0);
-		if (index == LEVELBREAK)
-		{
-			breadth++;
-			enqueue(q, LEVELBREAK);
-			if (dequeue(q, 1) == LEVELBREAK)
-				break;
-			continue;
-		}
-		curr = get_vertex_index(graph, index);
-		if (visited[curr->index] != EXPLORED)
+		free(visited);
+		return (0);
+	}
+	visited[graph->vertices->index] = BACKTRACK;
+	for (breadth = 0; queue.count > 0; breadth++)
+	{
+		if (!bfs_level(graph, &queue, visited, breadth, action))
 		{
-			visited[curr->index] = EXPLORED;
-			action(curr, breadth);
-			edge = curr->edges;
-			while (edge)
-			{
-				dest = edge->dest;
-				if (dest && visited[dest->index] == UNEXPLORED)
-					enqueue(q, dest->index), visited[dest->index] = BACKTRACK;
-				edge = edge->next;
-			}
+			free(queue.items);
+			free(visited);
+			return (0);
 		}
 	}
-	free(visited), free(q);
+	free(queue.items);
+	free(visited);
 	return (breadth - 1);
 }
@@ -0,0 +1,58 @@
+#include "graphs.h"
+
+/**
+ * graph_freeze - A function that takes a compressed-sparse-row snapshot of
+ * a graph
+ * The snapshot does not change when the graph does, and the graph stays
+ * usable; take a new snapshot to see later updates
+ * @graph: A pointer to the graph
+ *
+ * Return: A pointer to the snapshot, or NULL on failure
+ */
+csr_t *graph_freeze(const graph_t *graph)
+{
+	csr_t *csr;
+	vertex_t *v;
+	edge_t *edge;
+	size_t i, pos = 0;
+
+	if (graph == NULL)
+		return (NULL);
+	csr = malloc(sizeof(csr_t));
+	if (csr == NULL)
+		return (NULL);
+	csr->graph = graph;
+	csr->nb_vertices = graph->nb_vertices;
+	csr->nb_edges = 0;
+	for (i = 0; i < graph->nb_vertices; i++)
+		csr->nb_edges += graph->by_index[i]->nb_edges;
+	csr->offset = malloc((csr->nb_vertices + 1) * sizeof(size_t));
+	csr->dest = malloc((csr->nb_edges ? csr->nb_edges : 1) * sizeof(size_t));
+	if (csr->offset == NULL || csr->dest == NULL)
+	{
+		csr_delete(csr);
+		return (NULL);
+	}
+	for (i = 0; i < graph->nb_vertices; i++)
+	{
+		v = graph->by_index[i];
+		csr->offset[i] = pos;
+		for (edge = v->edges; edge != NULL; edge = edge->next)
+			csr->dest[pos++] = edge->dest->index;
+	}
+	csr->offset[i] = pos;
+	return (csr);
+}
+
+/**
+ * csr_delete - A function that frees a snapshot of a graph
+ * @csr: A pointer to the snapshot
+ */
+void csr_delete(csr_t *csr)
+{
+	if (csr == NULL)
+		return;
+	free(csr->offset);
+	free(csr->dest);
+	free(csr);
+}
@@ -0,0 +1,96 @@
+#include "graphs.h"
+
+/**
+ * csr_depth_first_traverse - A function that goes through a snapshot of a
+ * graph using the depth-first algorithm, visiting the vertices in the same
+ * order as depth_first_traverse
+ * @csr: A pointer to the snapshot to traverse
+ * @action: A  pointer to a function to be called for each visited vertex.
+ * Return: The max depth , or 0 on failure
+ */
+size_t csr_depth_first_traverse(const csr_t *csr,
+				void (*action)(const vertex_t *v, size_t depth))
+{
+	size_t depth = 0, top = 0, *cursor, dest;
+	unsigned char *visited;
+
+	if (csr == NULL || csr->nb_vertices == 0)
+		return (0);
+	visited = calloc(csr->nb_vertices, sizeof(unsigned char));
+	cursor = malloc(csr->nb_vertices * 2 * sizeof(size_t));
+	if (visited == NULL || cursor == NULL)
+	{
+		free(visited), free(cursor);
+		return (0);
+	}
+	action(get_vertex_index(csr->graph, 0), 0);
+	visited[0] = EXPLORED;
+	cursor[0] = csr->offset[0], cursor[1] = csr->offset[1];
+	while (1)
+	{
+		if (cursor[2 * top] == cursor[2 * top + 1])
+		{
+			if (top == 0)
+				break;
+			top--;
+			continue;
+		}
+		dest = csr->dest[cursor[2 * top]++];
+		if (visited[dest] != EXPLORED)
+		{
+			action(get_vertex_index(csr->graph, dest), ++top);
+			if (top > depth)
+				depth = top;
+			visited[dest] = EXPLORED;
+			cursor[2 * top] = csr->offset[dest];
+			cursor[2 * top + 1] = csr->offset[dest + 1];
+		}
+	}
+	free(visited), free(cursor);
+	return (depth);
+}
+
+/**
+ * csr_breadth_first_traverse - A function that goes through a snapshot of
+ * a graph using the breadth-first algorithm, visiting the vertices in the
+ * same order as breadth_first_traverse
+ * Every vertex is queued at most once, so the frontiers of all the levels
+ * follow each other in a single array
+ * @csr: A pointer to the snapshot to traverse
+ * @action: A  pointer to a function to be called for each visited vertex.
+ * Return: The max breadth , or 0 on failure
+ */
+size_t csr_breadth_first_traverse(const csr_t *csr,
+				  void (*action)(const vertex_t *v,
+						 size_t depth))
+{
+	size_t breadth = 0, front = 0, rear = 1, level, i, *queue;
+	unsigned char *visited;
+
+	if (csr == NULL || csr->nb_vertices == 0)
+		return (0);
+	visited = calloc(csr->nb_vertices, sizeof(unsigned char));
+	queue = malloc(csr->nb_vertices * sizeof(size_t));
+	if (visited == NULL || queue == NULL)
+	{
+		free(visited), free(queue);
+		return (0);
+	}
+	queue[0] = 0, visited[0] = BACKTRACK;
+	for (; front < rear; breadth++)
+	{
+		for (level = rear; front < level; front++)
+		{
+			action(get_vertex_index(csr->graph, queue[front]), breadth);
+			for (i = csr->offset[queue[front]];
+			     i < csr->offset[queue[front] + 1]; i++)
+				if (visited[csr->dest[i]] == UNEXPLORED)
+				{
+					visited[csr->dest[i]] = BACKTRACK;
+					queue[rear++] = csr->dest[i];
+				}
+		}
+	}
+	free(visited), free(queue);
+	return (breadth - 1);
+}
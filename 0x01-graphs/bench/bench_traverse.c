@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../graphs.h"
+
+/*
+ * Building and traversing large graphs: a random graph with four
+ * bidirectional edges per vertex, and a path, the deepest graph for DFS.
+ * Each graph is traversed through its linked lists, then through a CSR
+ * snapshot from graph_freeze.
+ *
+ * gcc -O2 -I. bench/bench_traverse.c 0-graph_create.c 1-graph_add_vertex.c \
+ *	2-graph_add_edge.c 3-graph_delete.c 4-depth_first_traverse.c \
+ *	5-breadth_first_traverse.c 6-graph_freeze.c 7-csr_traverse.c \
+ *	graph_index.c -o bench_traverse
+ * ./bench_traverse [vertices]
+ */
+
+/**
+ * bench_now - reads a monotonic clock
+ *
+ * Return: time in seconds
+ */
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static size_t visits;
+
+/**
+ * bench_visit - traversal action, counts the visited vertices
+ *
+ * @v: visited vertex
+ * @depth: depth of @v
+ */
+static void bench_visit(const vertex_t *v, size_t depth)
+{
+	(void)v;
+	(void)depth;
+	visits++;
+}
+
+/**
+ * bench_run - builds a graph and times both traversals
+ *
+ * @name: label of the graph
+ * @size: number of vertices
+ * @path: build a path instead of a random graph
+ */
+static void bench_run(const char *name, size_t size, int path)
+{
+	graph_t *graph = graph_create();
+	unsigned long seed = 42;
+	char src[32], dest[32];
+	double t0, t1, t2, t3, t4, t5, t6;
+	size_t i, dfs, bfs;
+	csr_t *csr;
+
+	if (graph == NULL)
+		return;
+	t0 = bench_now();
+	for (i = 0; i < size; i++)
+	{
+		sprintf(src, "v%lu", (unsigned long)i);
+		graph_add_vertex(graph, src);
+	}
+	for (i = 0; i < (path ? size - 1 : size * 4); i++)
+	{
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		sprintf(src, "v%lu", (unsigned long)(path ? i : (seed >> 33) % size));
+		sprintf(dest, "v%lu", (unsigned long)(path ? i + 1 :
+						       (seed >> 13) % size));
+		graph_add_edge(graph, src, dest, BIDIRECTIONAL);
+	}
+	t1 = bench_now();
+	visits = 0;
+	dfs = depth_first_traverse(graph, bench_visit);
+	t2 = bench_now();
+	bfs = breadth_first_traverse(graph, bench_visit);
+	t3 = bench_now();
+	printf("%-6s %8lu vertices  build %7.2f s  dfs %7.3f s (depth %lu)"
+	       "  bfs %7.3f s (depth %lu)  %lu visits\n", name,
+	       (unsigned long)size, t1 - t0, t2 - t1, (unsigned long)dfs,
+	       t3 - t2, (unsigned long)bfs, (unsigned long)visits);
+	visits = 0;
+	csr = graph_freeze(graph);
+	t4 = bench_now();
+	dfs = csr_depth_first_traverse(csr, bench_visit);
+	t5 = bench_now();
+	bfs = csr_breadth_first_traverse(csr, bench_visit);
+	t6 = bench_now();
+	printf("%-6s %8lu vertices  freeze %6.3f s  dfs %7.3f s (depth %lu)"
+	       "  bfs %7.3f s (depth %lu)  %lu visits\n", "csr",
+	       (unsigned long)size, t4 - t3, t5 - t4, (unsigned long)dfs,
+	       t6 - t5, (unsigned long)bfs, (unsigned long)visits);
+	csr_delete(csr);
+	graph_delete(graph);
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: number of arguments
+ * @av: arguments, av[1] is the number of vertices (default 1000000)
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	size_t size = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+
+	if (size < 2)
+		return (EXIT_FAILURE);
+	bench_run("random", size, 0);
+	bench_run("path", size, 1);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,223 @@
+#include "graphs.h"
+
+/**
+ * graph_hash - A function that hashes the content of a vertex (FNV-1a)
+ * @str: The string to hash
+ *
+ * Return: The hash of @str
+ */
+size_t graph_hash(const char *str)
+{
+	size_t hash = 14695981039346656037UL;
+
+	while (*str)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= 1099511628211UL;
+	}
+	return (hash);
+}
+
+/**
+ * graph_index_find - A function that fetches a vertex by its content
+ * @graph: A pointer to the graph
+ * @str: The string identifying the vertex
+ *
+ * Return: vertex on success, NULL if there is none
+ */
+vertex_t *graph_index_find(const graph_t *graph, const char *str)
+{
+	size_t slot, mask;
+
+	if (graph == NULL || str == NULL || graph->table == NULL)
+		return (NULL);
+	mask = graph->table_size - 1;
+	slot = graph_hash(str) & mask;
+	while (graph->table[slot] != NULL)
+	{
+		if (strcmp(graph->table[slot]->content, str) == 0)
+			return (graph->table[slot]);
+		slot = (slot + 1) & mask;
+	}
+	return (NULL);
+}
+
+/**
+ * graph_index_grow - A function that doubles the hash index of a graph
+ * @graph: A pointer to the graph
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_index_grow(graph_t *graph)
+{
+	size_t size = graph->table_size ? graph->table_size * 2 : GRAPH_INDEX_MIN;
+	vertex_t **table, *v;
+	size_t slot;
+
+	table = calloc(size, sizeof(vertex_t *));
+	if (table == NULL)
+		return (FAILURE);
+	for (v = graph->vertices; v != NULL; v = v->next)
+	{
+		slot = graph_hash(v->content) & (size - 1);
+		while (table[slot] != NULL)
+			slot = (slot + 1) & (size - 1);
+		table[slot] = v;
+	}
+	free(graph->table);
+	graph->table = table;
+	graph->table_size = size;
+	return (SUCCESS);
+}
+
+/**
+ * graph_index_add - A function that adds a vertex to the hash index of a
+ * graph, growing it to keep it at most half full
+ * @graph: A pointer to the graph
+ * @v: The vertex to add, not yet in the graph's list of vertices
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_index_add(graph_t *graph, vertex_t *v)
+{
+	size_t slot, mask;
+
+	if ((graph->nb_vertices + 1) * 2 > graph->table_size &&
+	    !graph_index_grow(graph))
+		return (FAILURE);
+	mask = graph->table_size - 1;
+	slot = graph_hash(v->content) & mask;
+	while (graph->table[slot] != NULL)
+		slot = (slot + 1) & mask;
+	graph->table[slot] = v;
+	return (SUCCESS);
+}
+
+/**
+ * graph_index_append - A function that stores a new vertex at the end of
+ * the index array of a graph, doubling it when full
+ * @graph: A pointer to the graph
+ * @v: The vertex to append, its index is graph->nb_vertices
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int graph_index_append(graph_t *graph, vertex_t *v)
+{
+	size_t size = graph->capacity ? graph->capacity * 2 : GRAPH_INDEX_MIN;
+	vertex_t **by_index;
+
+	if (graph->nb_vertices == graph->capacity)
+	{
+		by_index = realloc(graph->by_index, size * sizeof(vertex_t *));
+		if (by_index == NULL)
+			return (FAILURE);
+		graph->by_index = by_index;
+		graph->capacity = size;
+	}
+	graph->by_index[graph->nb_vertices] = v;
+	return (SUCCESS);
+}
+
+/**
+ * get_vertex_index - A function that fetches an vertex existing in graph by
+ * index, in constant time
+ * @graph: A pointer to the graph
+ * @index: The index identifying the vertex
+ *
+ * Return: vertex on success,  NULL on failure
+ */
+vertex_t *get_vertex_index(const graph_t *graph, size_t index)
+{
+	if (graph == NULL || index >= graph->nb_vertices)
+		return (NULL);
+	return (graph->by_index[index]);
+}
+
+/**
+ * edge_hash - A function that hashes the destination of an edge
+ * @dest: The destination vertex
+ * @size: Number of slots of the hash set, a power of two
+ *
+ * Return: The slot to start probing from
+ */
+size_t edge_hash(const vertex_t *dest, size_t size)
+{
+	size_t hash = dest->index * 11400714819323198485UL;
+
+	return ((hash ^ (hash >> 32)) & (size - 1));
+}
+
+/**
+ * edge_index_find - A function that checks the hash set of destinations of
+ * a vertex for an edge
+ * @src: The vertex the edge starts from, with a hash set
+ * @dest: The destination vertex
+ *
+ * Return: 1 if the edge exists, 0 if not
+ */
+int edge_index_find(const vertex_t *src, const vertex_t *dest)
+{
+	size_t slot = edge_hash(dest, src->adjacent_size);
+
+	while (src->adjacent[slot] != NULL)
+	{
+		if (src->adjacent[slot] == dest)
+			return (SUCCESS);
+		slot = (slot + 1) & (src->adjacent_size - 1);
+	}
+	return (FAILURE);
+}
+
+/**
+ * edge_index_grow - A function that rebuilds the hash set of destinations
+ * of a vertex from its edges, large enough for a number of edges
+ * @src: The vertex
+ * @count: Number of edges the hash set must hold at most half full
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int edge_index_grow(vertex_t *src, size_t count)
+{
+	size_t size = GRAPH_INDEX_MIN, slot;
+	vertex_t **adjacent;
+	edge_t *edge;
+
+	while (size < count * 2)
+		size *= 2;
+	adjacent = calloc(size, sizeof(vertex_t *));
+	if (adjacent == NULL)
+		return (FAILURE);
+	for (edge = src->edges; edge != NULL; edge = edge->next)
+	{
+		slot = edge_hash(edge->dest, size);
+		while (adjacent[slot] != NULL)
+			slot = (slot + 1) & (size - 1);
+		adjacent[slot] = edge->dest;
+	}
+	free(src->adjacent);
+	src->adjacent = adjacent;
+	src->adjacent_size = size;
+	return (SUCCESS);
+}
+
+/**
+ * edge_index_add - A function that adds a destination to the hash set of a
+ * vertex, building or growing the set as needed
+ * @src: The vertex the new edge starts from, its edge not yet linked
+ * @dest: The destination of the new edge
+ *
+ * Return: 1 on success, or 0 on failure
+ */
+int edge_index_add(vertex_t *src, vertex_t *dest)
+{
+	size_t slot;
+
+	if ((src->nb_edges + 1) * 2 > src->adjacent_size &&
+	    !edge_index_grow(src, src->nb_edges + 1))
+		return (FAILURE);
+	slot = edge_hash(dest, src->adjacent_size);
+	while (src->adjacent[slot] != NULL)
+		slot = (slot + 1) & (src->adjacent_size - 1);
+	src->adjacent[slot] = dest;
+	return (SUCCESS);
+}
@@ -7,8 +7,8 @@
 #define  UNEXPLORED 0
 #define  EXPLORED 1
 #define BACKTRACK 2
-#define SIZE 65536
-#define LEVELBREAK -60
+#define GRAPH_INDEX_MIN 16
+#define GRAPH_EDGE_HASH 16
 
 /**
  * enum edge_type_e - Enumerates the different types of
@@ -39,7 +39,6 @@ typedef struct edge_s
     struct edge_s   *next;
 } edge_t;
 
-
 /**
  * struct vertex_s - Node in the linked list of vertices in the adjacency list
  *
@@ -47,6 +46,10 @@ typedef struct edge_s
  * @content: Custom data stored in the vertex (here, a string)
  * @nb_edges: Number of conenctions with other vertices in the graph
  * @edges: Pointer to the head node of the linked list of edges
+ * @last: Pointer to the last node of the linked list of edges
+ * @adjacent: Open-addressing hash set of the destinations of the edges,
+ *   only built once the vertex has more than GRAPH_EDGE_HASH edges
+ * @adjacent_size: Number of slots in @adjacent, a power of two
  * @next: Pointer to the next vertex in the adjacency linked list
  *   This pointer points to another vertex in the graph, but it
  *   doesn't stand for an edge between the two vertices
@@ -57,6 +60,9 @@ struct vertex_s
     char        *content;
     size_t      nb_edges;
     edge_t      *edges;
+    edge_t      *last;
+    vertex_t    **adjacent;
+    size_t      adjacent_size;
     struct vertex_s *next;
 };
 
@@ -66,34 +72,83 @@ struct vertex_s
  *
  * @nb_vertices: Number of vertices in our graph
  * @vertices: Pointer to the head node of our adjacency linked list
+ * @by_index: Vertices indexed by their index, grown by doubling
+ * @capacity: Number of slots in @by_index
+ * @table: Open-addressing hash index of the vertices, keyed by content
+ * @table_size: Number of slots in @table, a power of two
  */
 typedef struct graph_s
 {
     size_t      nb_vertices;
     vertex_t    *vertices;
+    vertex_t    **by_index;
+    size_t      capacity;
+    vertex_t    **table;
+    size_t      table_size;
 } graph_t;
 
 /**
- * struct queue_s - Representation of a queue
+ * struct queue_s - Ring buffer of vertex indices, grown by doubling
  *
  * @items: items to be queued
- * @front: Pointer to the first item in queue
- * @rear: Pointer to the last item in queue
+ * @size: Number of slots in @items, 0 or a power of two
+ * @front: Position of the first item in queue
+ * @count: Number of items in queue
  */
 typedef struct queue_s
 {
-	int items[SIZE];
-	int front;
-	int rear;
+	size_t *items;
+	size_t size;
+	size_t front;
+	size_t count;
 } queue_t;
 
+/**
+ * struct csr_s - Immutable compressed-sparse-row snapshot of a graph
+ * The destinations of the edges of vertex i are dest[offset[i]] to
+ * dest[offset[i + 1] - 1], in the order of its linked list of edges
+ *
+ * @graph: Graph the snapshot was taken from, which must outlive it
+ * @nb_vertices: Number of vertices when the snapshot was taken
+ * @nb_edges: Number of edges when the snapshot was taken
+ * @offset: Position of the first edge of each vertex, plus @nb_edges
+ * @dest: Index of the destination of each edge
+ */
+typedef struct csr_s
+{
+	const graph_t *graph;
+	size_t nb_vertices;
+	size_t nb_edges;
+	size_t *offset;
+	size_t *dest;
+} csr_t;
+
 void graph_display(const graph_t *graph);
 graph_t *graph_create(void);
 vertex_t *graph_add_vertex(graph_t *graph, const char *str);
 int graph_add_edge(graph_t *g, const char *s, const char *d, edge_type_t t);
 void graph_delete(graph_t *graph);
+size_t graph_hash(const char *str);
+vertex_t *graph_index_find(const graph_t *graph, const char *str);
+int graph_index_grow(graph_t *graph);
+int graph_index_add(graph_t *graph, vertex_t *v);
+int graph_index_append(graph_t *graph, vertex_t *v);
+size_t edge_hash(const vertex_t *dest, size_t size);
+int edge_index_find(const vertex_t *src, const vertex_t *dest);
+int edge_index_grow(vertex_t *src, size_t count);
+int edge_index_add(vertex_t *src, vertex_t *dest);
+vertex_t *get_vertex_index(const graph_t *graph, size_t index);
+int enqueue(queue_t *q, size_t value);
+size_t dequeue(queue_t *q);
 size_t depth_first_traverse(const graph_t *graph,
 			    void (*action)(const vertex_t *v, size_t depth));
 size_t breadth_first_traverse(const graph_t *graph,
 			      void (*action)(const vertex_t *v,
 					      size_t depth));
+csr_t *graph_freeze(const graph_t *graph);
+void csr_delete(csr_t *csr);
+size_t csr_depth_first_traverse(const csr_t *csr,
+				void (*action)(const vertex_t *v, size_t depth));
+size_t csr_breadth_first_traverse(const csr_t *csr,
+				  void (*action)(const vertex_t *v,
+						 size_t depth));